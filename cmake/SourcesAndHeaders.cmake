@@ -1,7 +1,19 @@
 set(sources
     src/semic_grammar.cpp
     src/semic_token.cpp
+    src/source.cpp
+    src/compiler.cpp
     src/ir.cpp
+    src/kernels.cpp
+    src/cfg.cpp
+    src/ssa.cpp
+    src/sccp.cpp
+    src/gvn.cpp
+    src/licm.cpp
+    src/inline.cpp
+    src/dce.cpp
+    src/bytecode.cpp
+    src/vm.cpp
 )
 
 set(exe_sources
@@ -12,9 +24,17 @@ set(exe_sources
 set(headers
     include/semic_grammar.hpp
     include/node.hpp
+    include/arena.hpp
     include/ir.hpp
+    include/cfg.hpp
+    include/pass.hpp
     include/type_system.hpp
     include/sim.hpp
+    include/runtime.hpp
+    include/source.hpp
+    include/compiler.hpp
+    include/bytecode.hpp
+    include/vm.hpp
 )
 
 set(lex_sources
@@ -27,3 +47,19 @@ set(yacc_sources
 
 set(test_sources
 )
+
+# sample programs, each with the output it is expected to print in a .out
+# file beside it
+set(test_programs
+    test/programs/phi_loops.c
+    test/programs/sccp_branches.c
+    test/programs/gvn_loads.c
+    test/programs/licm_zero_trip.c
+    test/programs/inline_calls.c
+    test/programs/loops.c
+    test/programs/float_conditions.c
+    test/programs/float_rounding.c
+    test/programs/short_circuit.c
+    test/programs/switch.c
+    test/programs/many_functions.c
+)
@@ -0,0 +1,75 @@
+#ifndef SEMIC_ARENA_HPP_INCLUDED
+#define SEMIC_ARENA_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bump allocator for objects that die together: the nodes of one
+// translation unit, the blocks and instructions of one IR function. Users
+// link the objects with plain pointers; everything is destroyed together
+// by clear() or when the arena goes away.
+class Arena {
+public:
+    Arena() {}
+    Arena(const Arena &) = delete;
+    Arena& operator=(const Arena &) = delete;
+
+    ~Arena() {
+        clear();
+    }
+
+    template <typename T, typename... Args>
+    T* make(Args&&... args) {
+        T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            destructors.push_back({ object, [](void* pointer) { static_cast<T*>(pointer)->~T(); } });
+        }
+        return object;
+    }
+
+    void clear() {
+        for (auto it = destructors.rbegin(); it != destructors.rend(); it++) {
+            it->destroy(it->object);
+        }
+        destructors.clear();
+        chunks.clear();
+        cursor = limit = nullptr;
+    }
+
+private:
+    static constexpr size_t chunk_size = 64 << 10;
+
+    struct Destructor {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    std::vector<std::unique_ptr<char[]>> chunks;
+    std::vector<Destructor> destructors;
+    char* cursor = nullptr;
+    char* limit = nullptr;
+
+    void* allocate(size_t size, size_t align) {
+        auto address = reinterpret_cast<uintptr_t>(cursor);
+        size_t padding = (align - address % align) % align;
+        if (!cursor || padding + size > static_cast<size_t>(limit - cursor)) {
+            // objects bigger than a chunk get a chunk of their own
+            size_t length = std::max(chunk_size, size + align);
+            chunks.emplace_back(new char[length]);
+            cursor = chunks.back().get();
+            limit = cursor + length;
+            address = reinterpret_cast<uintptr_t>(cursor);
+            padding = (align - address % align) % align;
+        }
+        void* result = cursor + padding;
+        cursor += padding + size;
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef SEMIC_BYTECODE_HPP_INCLUDED
+#define SEMIC_BYTECODE_HPP_INCLUDED
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "ir.hpp"
+
+// Every opcode of the register bytecode. Operands `a`, `b`, `c` are frame
+// slot indices unless noted otherwise:
+//   binary ops      a = b op c, _w wraps the result to 32 bits
+//   inc/dec         b += 1 / b -= 1, then a = b
+//   cvt             a = (to) b
+//   sext_N          a = low N bits of b, sign-extended
+//   index_N         a = b + c * N
+//   load            a = *b
+//   store           *a = b
+//   jmp             pc = a
+//   br_true/false   if (b != 0) / (b == 0) pc = a, _f and _d compare
+//                   a float or a double with 0
+//   switch_table    pc = entry b - low of switch table a, or its default
+//   switch_search   pc = target of key b in switch table a, or its default
+//   call            a = call site index
+//   printf          a = print site index
+//   ret             a = value slot
+#define BYTECODE_OPCODES(X) \
+    X(mov) \
+    X(add_w) X(sub_w) X(mul_w) X(div_w) \
+    X(add_i) X(sub_i) X(mul_i) X(div_i) \
+    X(add_f) X(sub_f) X(mul_f) X(div_f) \
+    X(add_d) X(sub_d) X(mul_d) X(div_d) \
+    X(lt_i) X(gt_i) X(le_i) X(ge_i) \
+    X(lt_f) X(gt_f) X(le_f) X(ge_f) \
+    X(lt_d) X(gt_d) X(le_d) X(ge_d) \
+    X(and_i) X(or_i) X(and_f) X(or_f) X(and_d) X(or_d) \
+    X(inc_w) X(dec_w) X(inc_i) X(dec_i) X(inc_f) X(dec_f) X(inc_d) X(dec_d) \
+    X(cvt_i_f) X(cvt_i_d) X(cvt_f_i) X(cvt_d_i) X(cvt_f_d) X(cvt_d_f) \
+    X(sext_8) X(sext_16) X(sext_32) \
+    X(index_1) X(index_2) X(index_4) X(index_8) \
+    X(load_i8) X(load_i16) X(load_i32) X(load_i64) X(load_f) X(load_d) \
+    X(store_i8) X(store_i16) X(store_i32) X(store_i64) X(store_f) X(store_d) \
+    X(jmp) X(br_true) X(br_false) X(br_true_f) X(br_false_f) X(br_true_d) X(br_false_d) \
+    X(switch_table) X(switch_search) \
+    X(call) X(printf) X(ret) X(ret_void)
+
+enum class BCOpcode : uint16_t {
+#define BYTECODE_ENUM(name) name,
+    BYTECODE_OPCODES(BYTECODE_ENUM)
+#undef BYTECODE_ENUM
+};
+
+enum class BCKind : uint8_t {
+    none,
+    integer,
+    float32,
+    float64,
+    pointer,
+    string,
+};
+
+// integers of every width are held sign-extended to 64 bits
+union BCSlot {
+    uint64_t i;
+    int64_t l;
+    float f;
+    double d;
+    void* p;
+    const std::string* s;
+};
+
+struct BCInstruction {
+    // label of the opcode handler, filled in by the VM before execution
+    const void* handler;
+    BCOpcode op;
+    int32_t a, b, c;
+};
+
+struct BCPrintArgument {
+    int32_t slot;
+    BCKind kind;
+    // arrays are printed element by element
+    size_t array_length;
+    size_t element_size;
+    BCKind element_kind;
+};
+
+struct BCCallSite {
+    int32_t callee;
+    int32_t result_slot;
+    std::vector<int32_t> arg_slots;
+    std::vector<BCPrintArgument> print_args;
+};
+
+struct BCPrintSite {
+    std::vector<BCPrintArgument> print_args;
+};
+
+// Targets of a switch. A dense table holds one target per value from
+// `low` on; a sparse one is binary searched for the value among `keys`.
+struct BCSwitchTable {
+    int64_t low = 0;
+    std::vector<int64_t> keys;
+    std::vector<int32_t> targets;
+    int32_t default_target = 0;
+};
+
+struct BCArray {
+    int32_t slot;
+    size_t size;
+};
+
+class BCFunction {
+public:
+    std::string name;
+    BCKind return_kind = BCKind::none;
+    int32_t param_count = 0;
+    int32_t frame_size = 0;
+
+    // literal operands live in the last slots of every frame and are copied
+    // in from `constants` on entry
+    int32_t constant_base = 0;
+    std::vector<BCSlot> constants;
+    std::vector<BCKind> constant_kinds;
+
+    std::vector<BCArray> arrays;
+    std::vector<BCInstruction> code;
+    std::vector<BCCallSite> call_sites;
+    std::vector<BCPrintSite> print_sites;
+    std::vector<BCSwitchTable> switch_tables;
+
+    void print();
+};
+
+class BytecodeModule {
+public:
+    std::vector<BCFunction> functions;
+    std::deque<std::string> strings;
+    int32_t entry = -1;
+
+    void print() {
+        for (auto &func : functions) {
+            func.print();
+        }
+    }
+};
+
+const char* bc_opcode_to_str(BCOpcode op);
+
+BytecodeModule lower_to_bytecode(CodeGenContext &context);
+
+#endif
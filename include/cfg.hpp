@@ -0,0 +1,64 @@
+#ifndef SEMIC_CFG_HPP_INCLUDED
+#define SEMIC_CFG_HPP_INCLUDED
+
+#include <vector>
+
+#include "ir.hpp"
+
+// Control flow graph of one function and its dominator tree, indexed by
+// bid. Blocks the entry cannot reach have no dominator and are left out
+// of `order`; passes leave them alone.
+class ControlFlowGraph {
+public:
+    // successors without repeats, predecessors among reachable blocks
+    std::vector<std::vector<int>> succs, preds;
+    // reachable blocks in reverse postorder, the entry first
+    std::vector<int> order;
+    // immediate dominator, -1 for the entry and unreachable blocks
+    std::vector<int> idom;
+    std::vector<std::vector<int>> dom_children;
+
+    explicit ControlFlowGraph(IRFunction &func);
+
+    bool reachable(int bid) const {
+        return rpo_index[static_cast<size_t>(bid)] >= 0;
+    }
+
+    // a block dominates itself
+    bool dominates(int dominator, int bid) const {
+        return reachable(dominator) && reachable(bid) &&
+            dom_enter[static_cast<size_t>(dominator)] <= dom_enter[static_cast<size_t>(bid)] &&
+            dom_exit[static_cast<size_t>(bid)] <= dom_exit[static_cast<size_t>(dominator)];
+    }
+
+    std::vector<std::vector<int>> dominance_frontiers() const;
+
+private:
+    std::vector<int> rpo_index;
+    // preorder and postorder numbers in the dominator tree
+    std::vector<int> dom_enter, dom_exit;
+};
+
+// Slots some instruction writes in place rather than defines: variables
+// left in memory, and temps that inc and dec write back. Reading one does
+// not always give the same value.
+std::vector<bool> find_written_slots(IRFunction &func);
+
+// Natural loop: a header and every block that reaches one of its back
+// edges without passing through the header. Loops sharing a header are
+// one loop.
+struct Loop {
+    int header;
+    // sorted by bid, the header included
+    std::vector<int> blocks;
+    // the only block outside the loop that enters it, if there is one and
+    // it leads nowhere else
+    int preheader = -1;
+
+    bool contains(int bid) const;
+};
+
+// innermost loops first
+std::vector<Loop> find_loops(const ControlFlowGraph &cfg);
+
+#endif
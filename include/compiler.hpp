@@ -0,0 +1,34 @@
+#ifndef SEMIC_COMPILER_HPP_INCLUDED
+#define SEMIC_COMPILER_HPP_INCLUDED
+
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "ir.hpp"
+#include "source.hpp"
+
+// Turns program text into IR. A compiler holds no state between calls and
+// nothing is shared with other compilers beyond the symbol and type
+// tables, so separate threads may compile separate programs at once.
+// Syntax and semantic errors are thrown as std::runtime_error.
+class Compiler {
+public:
+    // copy the source text to stdout while it is scanned
+    bool echo = false;
+    // threads generating function bodies, 1 generates them on the caller
+    unsigned jobs = std::thread::hardware_concurrency();
+    // run the passes of pass.hpp over every function
+    bool optimize = true;
+    // inline small functions as well; an inlined call no longer traces
+    // its arguments and return value, so this changes what a program
+    // prints and is left off unless asked for
+    bool inline_calls = false;
+
+    std::unique_ptr<CodeGenContext> compile(SourceFile &source);
+
+private:
+    void for_each_function(size_t count, const std::function<void(size_t)> &task);
+};
+
+#endif
@@ -1,150 +1,110 @@
 #ifndef SEMIC_IR_HPP_INCLUDED
 #define SEMIC_IR_HPP_INCLUDED
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <stack>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <variant>
 #include <string>
+#include <stdexcept>
+#include <type_traits>
 
+#include "arena.hpp"
 #include "type_system.hpp"
+#include "runtime.hpp"
+#include "source.hpp"
 
 class FunctionContext;
+class IRFunction;
 
-enum IROpearndType {
+enum IROpearndType : uint8_t {
     unknown_operand,
     id,
     temp,
-    literal_double,
-    literal_int,
-    literal_string,
+    constant,
 };
 
-struct TempOperand {
-    int bid, index;
-};
+// Operand of an instruction: 16 bytes and trivially copyable. Variables
+// and temps are read from a frame slot, constants from the pool of the
+// enclosing function.
+class IRValue {
+public:
+    // slots are stored in 24 bits
+    static constexpr int max_slot = (1 << 23) - 1;
+
+    Type* value_type;
+    IROpearndType type : 8;
+    // frame slot of a variable or temp, -1 otherwise
+    int slot : 24;
+    // symbol of a variable, pool index of a constant
+    uint32_t payload;
+
+    IRValue(IROpearndType n_type, Type* n_value_type, int n_slot = -1, uint32_t n_payload = 0) :
+        value_type(n_value_type), type(n_type), payload(n_payload) {
+        set_slot(n_slot);
+    }
 
-struct Operand {
-    std::string name;
-};
+    static IRValue from_operand(
+        std::map<Symbol, Type*> &variable_types,
+        std::map<Symbol, int> &variable_slots,
+        Symbol n_name
+    ) {
+        auto slot_it = variable_slots.find(n_name);
+        if (slot_it == variable_slots.end()) {
+            throw std::runtime_error("Undeclared identifier " + SymbolTable::global().get(n_name));
+        }
+        return IRValue(IROpearndType::id, variable_types[n_name], slot_it->second, n_name);
+    }
 
-using IROperand = std::variant<Operand, TempOperand, double, uint64_t, std::string>;
+    static IRValue from_temp(Type* n_value_type, int n_slot) {
+        return IRValue(IROpearndType::temp, n_value_type, n_slot);
+    }
 
-class IRValue {
-public:
-    IROpearndType type;
-    std::shared_ptr<Type> value_type;
-    IROperand operand;
-
-    IRValue(IROpearndType n_type, std::shared_ptr<Type> n_value_type, IROperand n_operand) :
-        type(n_type), value_type(n_value_type), operand(n_operand) {}
-
-    static IRValue from_double(double n_literal_double) {
-        return IRValue(
-            IROpearndType::literal_double,
-            std::make_shared<FloatType>(64),
-            n_literal_double
-        );
+    static IRValue from_constant(Type* n_value_type, int n_index) {
+        return IRValue(IROpearndType::constant, n_value_type, -1, static_cast<uint32_t>(n_index));
     }
 
-    static IRValue from_int(uint64_t n_literal_int) {
-        return IRValue(
-            IROpearndType::literal_int,
-            std::make_shared<IntegerType>(64),
-            n_literal_int
-        );
+    // frame slot of a variable or temp, -1 for constants
+    int get_slot() const {
+        return slot;
     }
 
-    static IRValue from_literal_string(std::string &n_literal_string) {
-        return IRValue(
-            IROpearndType::literal_string,
-            std::make_shared<StringType>(),
-            n_literal_string
-        );
+    // the only write to the bitfield; the mask keeps the conversion exact
+    void set_slot(int n_slot) {
+        if (n_slot < -1 || n_slot > max_slot) {
+            throw std::runtime_error("Frame slot " + std::to_string(n_slot) + " does not fit in an operand");
+        }
+        slot = n_slot < 0 ? -1 : n_slot & max_slot;
     }
 
-    static IRValue from_operand(
-        std::map<std::string, std::shared_ptr<Type>> &variable_types,
-        std::string &n_name
-    ) {
-        return IRValue(
-            IROpearndType::id,
-            variable_types[n_name],
-            Operand {
-                n_name,
-            }
-        );
+    Symbol get_symbol() const {
+        return payload;
     }
 
-    static IRValue from_bid(
-        std::map<std::string, std::shared_ptr<Type>> &variable_types,
-        int bid,
-        int index
-    ) {
-        return IRValue(
-            IROpearndType::temp,
-            variable_types[std::to_string(bid) + ':' + std::to_string(index)],
-            TempOperand {
-                bid,
-                index
-            }
-        );
+    size_t get_constant_index() const {
+        return payload;
     }
 
     std::string get_name() const {
         switch (type)
         {
-        case IROpearndType::id : {
-            Operand op_value = std::get<Operand>(operand);
-            return op_value.name;
-        }
-        case IROpearndType::temp : {
-            TempOperand temp_value = std::get<TempOperand>(operand);
-            return std::to_string(temp_value.bid) + ':' + std::to_string(temp_value.index);
-        }
+        case IROpearndType::id :
+            return SymbolTable::global().get(payload);
+        case IROpearndType::temp :
+            return '%' + std::to_string(slot);
+        case IROpearndType::constant :
+            return '$' + std::to_string(payload);
         default:
             return "unknown";
         }
     }
 
     std::string to_string() const {
-        std::string result = value_type->get_type_name() + ' ';
-        switch (type)
-        {
-        case IROpearndType::id : {
-            Operand op_value = std::get<Operand>(operand);
-            return result + op_value.name;
-            break;
-        }
-        case IROpearndType::literal_double : {
-            double double_value = std::get<double>(operand);
-            return result + std::to_string(double_value);
-            break;
-        }
-        case IROpearndType::literal_int : {
-            uint64_t int_value = std::get<uint64_t>(operand);
-            return result + std::to_string(int_value);
-            break;
-        }
-        case IROpearndType::literal_string : {
-            std::string str_value = std::get<std::string>(operand);
-            return result + str_value;
-            break;
-        }
-        case IROpearndType::temp : {
-            TempOperand temp_value = std::get<TempOperand>(operand);
-            return result + std::to_string(temp_value.bid) + ':'
-                + std::to_string(temp_value.index);
-            break;
-        }
-        case IROpearndType::unknown_operand : {
-            return result + std::string("unknown");
-            break;
-        }
-        default:
-            return result + std::string("unknown");
-        }
+        return value_type->get_type_name() + ' ' + get_name();
     }
 
     void print() {
@@ -152,6 +112,42 @@ public:
     }
 };
 
+static_assert(sizeof(IRValue) == 16, "IRValue is meant to be passed around by value");
+static_assert(std::is_trivially_copyable<IRValue>::value, "IRValue is meant to be passed around by value");
+
+// Literal of a constant pool. Operands refer to it by index, so the text
+// of a string literal is stored once per function.
+class IRLiteral {
+public:
+    Type* value_type;
+    std::variant<uint64_t, double, std::string> value;
+
+    static IRLiteral from_int(uint64_t n_value,
+        Type* n_value_type = TypeContext::global().get_integer_type(64)) {
+        return IRLiteral { n_value_type, n_value };
+    }
+
+    static IRLiteral from_double(double n_value,
+        Type* n_value_type = TypeContext::global().get_float_type(64)) {
+        return IRLiteral { n_value_type, n_value };
+    }
+
+    static IRLiteral from_string(const std::string &n_value) {
+        return IRLiteral { TypeContext::global().get_string_type(), n_value };
+    }
+
+    std::string to_string() const {
+        std::string result = value_type->get_type_name() + ' ';
+        if (auto int_value = std::get_if<uint64_t>(&value)) {
+            return result + std::to_string(*int_value);
+        }
+        if (auto double_value = std::get_if<double>(&value)) {
+            return result + std::to_string(*double_value);
+        }
+        return result + std::get<std::string>(value);
+    }
+};
+
 class IRJump {
 public:
     enum IRJumpType {
@@ -159,6 +155,7 @@ public:
         direct,
         cond,
         ret,
+        multiway,
     };
 
     IRJumpType jump_type;
@@ -175,7 +172,21 @@ public:
         IRValue return_value;
     };
 
-    std::variant<DirectJump, CondJump, RetJump> jump;
+    // a switch: the target of the case equal to the value, or the default
+    struct SwitchJump {
+        IRValue value;
+        // case values in ascending order with their targets
+        std::vector<std::pair<int64_t, int>> cases;
+        int default_bid;
+
+        int target_of(int64_t key) const {
+            auto it = std::lower_bound(cases.begin(), cases.end(), key,
+                [](const std::pair<int64_t, int> &item, int64_t k) { return item.first < k; });
+            return it != cases.end() && it->first == key ? it->second : default_bid;
+        }
+    };
+
+    std::variant<DirectJump, CondJump, RetJump, SwitchJump> jump;
 
     IRJump() : jump_type(IRJumpType::unknown) { }
 
@@ -209,8 +220,78 @@ public:
         return new_jump;
     }
 
+    static IRJump from_switch_jump(IRValue &n_value,
+        std::vector<std::pair<int64_t, int>> n_cases, int n_default_bid) {
+        std::sort(n_cases.begin(), n_cases.end());
+        IRJump new_jump;
+        new_jump.jump_type = IRJumpType::multiway;
+        new_jump.jump = SwitchJump {
+            n_value,
+            std::move(n_cases),
+            n_default_bid
+        };
+        return new_jump;
+    }
+
     void run(FunctionContext* context);
 
+    // blocks control may pass to, a target named twice is listed twice
+    std::vector<int> targets() const {
+        switch (jump_type) {
+        case direct:
+            return { std::get<DirectJump>(jump).jump_bid };
+        case cond: {
+            auto &cond_jump = std::get<CondJump>(jump);
+            return { cond_jump.true_bid, cond_jump.false_bid };
+        }
+        case multiway: {
+            auto &switch_jump = std::get<SwitchJump>(jump);
+            std::vector<int> bids;
+            for (auto &item : switch_jump.cases) {
+                bids.push_back(item.second);
+            }
+            bids.push_back(switch_jump.default_bid);
+            return bids;
+        }
+        default:
+            return {};
+        }
+    }
+
+    void visit_targets(const std::function<void(int&)> &visit) {
+        if (jump_type == direct) {
+            visit(std::get<DirectJump>(jump).jump_bid);
+        } else if (jump_type == cond) {
+            auto &cond_jump = std::get<CondJump>(jump);
+            visit(cond_jump.true_bid);
+            visit(cond_jump.false_bid);
+        } else if (jump_type == multiway) {
+            auto &switch_jump = std::get<SwitchJump>(jump);
+            for (auto &item : switch_jump.cases) {
+                visit(item.second);
+            }
+            visit(switch_jump.default_bid);
+        }
+    }
+
+    void replace_target(int old_bid, int new_bid) {
+        visit_targets([&](int &bid) {
+            if (bid == old_bid) {
+                bid = new_bid;
+            }
+        });
+    }
+
+    // the condition or returned value, nullptr if the jump reads none
+    IRValue* operand() {
+        switch (jump_type) {
+        case cond: return &std::get<CondJump>(jump).cond_value;
+        case ret: return &std::get<RetJump>(jump).return_value;
+        case multiway: return &std::get<SwitchJump>(jump).value;
+        default: return nullptr;
+        }
+    }
+
     void print(std::string prefix) {
         std::cout << prefix;
         switch (jump_type)
@@ -228,6 +309,16 @@ public:
             break;
         }
 
+        case multiway: {
+            auto &switch_jump = std::get<SwitchJump>(jump);
+            std::cout << "switch " << '<' << switch_jump.value.to_string() << '>';
+            for (auto &item : switch_jump.cases) {
+                std::cout << ' ' << item.first << ":b" << item.second;
+            }
+            std::cout << " default:b" << switch_jump.default_bid;
+            break;
+        }
+
         case ret: {
             RetJump ret_jump = std::get<RetJump>(jump);
             std::cout << "ret " << '<' << ret_jump.return_value.to_string() << '>';
@@ -265,6 +356,7 @@ enum IROptype {
     printf_func,
     load,
     store,
+    phi,
     unknown_op,
 };
 
@@ -298,6 +390,12 @@ static std::string ir_optype_to_str(IROptype type) {
     case greater:
         return std::string("GT");
         break;
+    case less_equal:
+        return std::string("LE");
+        break;
+    case greater_equal:
+        return std::string("GE");
+        break;
     case array_index:
         return std::string("ARRAY_INDEX");
         break;
@@ -317,36 +415,141 @@ static std::string ir_optype_to_str(IROptype type) {
     case store:
         return std::string("STORE");
         break;
+    case phi:
+        return std::string("PHI");
+        break;
     default:
         return std::string("UNKNOWN");
         break;
     }
 }
 
+// Machine type an instruction operates on. It is fixed at codegen, after
+// operands have been converted, so execution never inspects types.
+enum class IRKind : uint8_t {
+    none,
+    i8,
+    i16,
+    i32,
+    i64,
+    f32,
+    f64,
+    ptr,
+    str,
+};
+
+inline IRKind ir_kind_of(Type* type) {
+    switch (type->type_id) {
+    case Type::TypeID::IntegerTyID:
+        switch (type->get_size()) {
+        case 1: return IRKind::i8;
+        case 2: return IRKind::i16;
+        case 4: return IRKind::i32;
+        default: return IRKind::i64;
+        }
+    case Type::TypeID::FloatTyID:
+        return static_cast<FloatType*>(type)->bit_width == 64 ? IRKind::f64 : IRKind::f32;
+    case Type::TypeID::DoubleTyID:
+        return IRKind::f64;
+    case Type::TypeID::PointerTyID:
+    case Type::TypeID::ArrayTyID:
+        return IRKind::ptr;
+    case Type::TypeID::StringTyID:
+        return IRKind::str;
+    default:
+        return IRKind::none;
+    }
+}
+
+inline std::string ir_kind_to_str(IRKind kind) {
+    switch (kind) {
+    case IRKind::i8: return "i8";
+    case IRKind::i16: return "i16";
+    case IRKind::i32: return "i32";
+    case IRKind::i64: return "i64";
+    case IRKind::f32: return "f32";
+    case IRKind::f64: return "f64";
+    case IRKind::ptr: return "ptr";
+    case IRKind::str: return "str";
+    default: return "none";
+    }
+}
+
+// instructions that do more than compute their result
+inline bool has_side_effects(IROptype type) {
+    switch (type) {
+    case IROptype::assign:
+    case IROptype::inc:
+    case IROptype::dec:
+    case IROptype::call:
+    case IROptype::printf_func:
+    case IROptype::store:
+    case IROptype::unknown_op:
+        return true;
+    default:
+        return false;
+    }
+}
+
+inline bool is_comparison(IROptype type) {
+    return type == IROptype::less || type == IROptype::greater ||
+        type == IROptype::less_equal || type == IROptype::greater_equal ||
+        type == IROptype::land || type == IROptype::lor;
+}
+
+// Kernels implement one operation on one kind; see src/kernels.cpp. They
+// return nullptr for combinations that have no meaning.
+using BinaryKernel = Value (*)(Value, Value);
+using UnaryKernel = Value (*)(Value);
+using LoadKernel = Value (*)(const void*);
+using StoreKernel = void (*)(void*, Value);
+
+BinaryKernel select_binary_kernel(IROptype op, IRKind kind);
+UnaryKernel select_unary_kernel(IROptype op, IRKind kind);
+UnaryKernel select_cast_kernel(IRKind from, IRKind to);
+LoadKernel select_load_kernel(IRKind kind);
+StoreKernel select_store_kernel(IRKind kind);
+
 class IR {
 public:
     IROptype type;
+    // frame slot receiving the result, -1 if the result is void
+    int result_slot = -1;
     IR(IROptype n_type) : type(n_type) {}
 
     virtual ~IR() = default;
 
     virtual void print(std::string prefix) = 0;
 
-    virtual std::shared_ptr<Type> result_type() = 0;
+    virtual Type* result_type() = 0;
 
     virtual void run(FunctionContext*) = 0;
+
+    // every operand, the written variable of assign, inc and dec included
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) = 0;
+
+    // a copy allocated in `arena`, operands and result slot unchanged
+    virtual IR* clone(Arena &arena) const = 0;
 };
 
 class IRBinary : public IR {
 public:
     IRValue lhs, rhs;
+    // kind of both operands
+    IRKind kind;
+    BinaryKernel kernel;
 
     IRBinary(IROptype n_type, IRValue n_lhs, IRValue n_rhs) :
-        IR(n_type), lhs(n_lhs), rhs(n_rhs) {}
+        IR(n_type), lhs(n_lhs), rhs(n_rhs), kind(ir_kind_of(n_lhs.value_type)),
+        kernel(n_type == IROptype::assign ? nullptr : select_binary_kernel(n_type, kind)) {
+        if (n_type != IROptype::assign && !kernel) {
+            throw std::runtime_error("Invalid operands to " + ir_optype_to_str(n_type));
+        }
+    }
 
     virtual void print(std::string prefix) override {
         std::cout << prefix;
-        std::cout << ir_optype_to_str(type) << ' ';
+        std::cout << ir_optype_to_str(type) << '.' << ir_kind_to_str(kind) << ' ';
         std::cout << '<';
         lhs.print();
         std::cout << '>' << ' ';
@@ -355,32 +558,59 @@ public:
         std::cout << '>';
     }
 
-    virtual std::shared_ptr<Type> result_type() override {
+    virtual Type* result_type() override {
+        if (is_comparison(type)) {
+            return TypeContext::global().get_integer_type(32);
+        }
         return lhs.value_type;
     }
 
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        visit(lhs);
+        visit(rhs);
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRBinary>(*this);
+    }
+
     virtual void run(FunctionContext*) override;
 };
 
 class IRUnary : public IR {
 public:
     IRValue lhs;
+    IRKind kind;
+    UnaryKernel kernel;
 
     IRUnary(IROptype n_type, IRValue n_lhs) :
-        IR(n_type), lhs(n_lhs) {}
+        IR(n_type), lhs(n_lhs), kind(ir_kind_of(n_lhs.value_type)),
+        kernel(select_unary_kernel(n_type, kind)) {
+        if (!kernel) {
+            throw std::runtime_error("Invalid operand to " + ir_optype_to_str(n_type));
+        }
+    }
 
     virtual void print(std::string prefix) {
         std::cout << prefix;
-        std::cout << ir_optype_to_str(type) << ' ';
+        std::cout << ir_optype_to_str(type) << '.' << ir_kind_to_str(kind) << ' ';
         std::cout << '<';
         lhs.print();
         std::cout << '>';
     }
 
-    virtual std::shared_ptr<Type> result_type() {
+    virtual Type* result_type() {
         return lhs.value_type;
     }
 
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        visit(lhs);
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRUnary>(*this);
+    }
+
     virtual void run(FunctionContext*) override;
 };
 
@@ -404,8 +634,18 @@ public:
         std::cout << ')';
     }
 
-    virtual std::shared_ptr<Type> result_type() {
-        return std::make_shared<VoidType>();
+    virtual Type* result_type() {
+        return TypeContext::global().get_void_type();
+    }
+
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        for (auto &arg : arguments) {
+            visit(arg);
+        }
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRPrintf>(*this);
     }
 
     virtual void run(FunctionContext*) override;
@@ -413,13 +653,16 @@ public:
 
 class IRMethodCall : public IR {
 public:
-    std::shared_ptr<Type> return_type;
-    std::string name;
+    Type* return_type;
+    Symbol name;
     std::vector<IRValue> arguments;
+    // filled in by resolve() from the declaration of the callee
+    IRFunction* callee = nullptr;
+    std::vector<int> param_slots;
 
     IRMethodCall(
-        std::shared_ptr<Type> n_return_type,
-        std::string n_name,
+        Type* n_return_type,
+        Symbol n_name,
         std::vector<IRValue> n_arguments
     ) : IR(IROptype::call),
         return_type(n_return_type),
@@ -428,7 +671,7 @@ public:
 
     virtual void print(std::string prefix) {
         std::cout << prefix;
-        std::cout << ir_optype_to_str(type) << " " << name << '(';
+        std::cout << ir_optype_to_str(type) << " " << SymbolTable::global().get(name) << '(';
         for(auto arg : arguments) {
             std::cout << '<';
             arg.print();
@@ -437,10 +680,22 @@ public:
         std::cout << ')';
     }
 
-    virtual std::shared_ptr<Type> result_type() {
+    virtual Type* result_type() {
         return return_type;
     }
 
+    void resolve(IRFunction* n_callee);
+
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        for (auto &arg : arguments) {
+            visit(arg);
+        }
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRMethodCall>(*this);
+    }
+
     virtual void run(FunctionContext*) override;
 };
 
@@ -462,53 +717,96 @@ public:
         std::cout << '>';
     }
 
-    virtual std::shared_ptr<Type> result_type() {
-        return std::make_shared<PointerType>(
+    virtual Type* result_type() {
+        return TypeContext::global().get_pointer_type(
             array.value_type->get_element_type()
         );
     }
 
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        visit(array);
+        visit(index);
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRArrayIndex>(*this);
+    }
+
     virtual void run(FunctionContext*) override;
 };
 
 class IRLoad : public IR {
 public:
     IRValue pointer;
+    // kind of the element read
+    IRKind kind;
+    LoadKernel kernel;
 
     IRLoad(IRValue n_pointer) :
-        IR(IROptype::load), pointer(n_pointer) {}
+        IR(IROptype::load), pointer(n_pointer),
+        kind(ir_kind_of(n_pointer.value_type->get_element_type())),
+        kernel(select_load_kernel(kind)) {
+        if (!kernel) {
+            throw std::runtime_error("Unsupported element type");
+        }
+    }
 
     virtual void print(std::string prefix) {
         std::cout << prefix;
-        std::cout << "LOAD " << '<';
+        std::cout << "LOAD." << ir_kind_to_str(kind) << ' ' << '<';
         pointer.print();
         std::cout << '>';
     }
 
-    virtual std::shared_ptr<Type> result_type() {
+    virtual Type* result_type() {
         return pointer.value_type->get_element_type();
     }
 
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        visit(pointer);
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRLoad>(*this);
+    }
+
     virtual void run(FunctionContext*) override;
 };
 
 class IRStore : public IR {
 public:
     IRValue pointer, value;
+    IRKind kind;
+    StoreKernel kernel;
 
     IRStore(IRValue n_pointer, IRValue n_value) :
-        IR(IROptype::store), pointer(n_pointer), value(n_value) {}
+        IR(IROptype::store), pointer(n_pointer), value(n_value),
+        kind(ir_kind_of(n_pointer.value_type->get_element_type())),
+        kernel(select_store_kernel(kind)) {
+        if (!kernel) {
+            throw std::runtime_error("Unsupported element type");
+        }
+    }
 
     virtual void print(std::string prefix) {
         std::cout << prefix;
-        std::cout << "STORE " << '<';
+        std::cout << "STORE." << ir_kind_to_str(kind) << ' ' << '<';
         pointer.print();
         std::cout << '>' << ' ';
         value.print();
     }
 
-    virtual std::shared_ptr<Type> result_type() {
-        return std::make_shared<VoidType>();
+    virtual Type* result_type() {
+        return TypeContext::global().get_void_type();
+    }
+
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        visit(pointer);
+        visit(value);
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRStore>(*this);
     }
 
     virtual void run(FunctionContext*) override;
@@ -516,11 +814,18 @@ public:
 
 class IRCast : public IR {
 public:
-    std::shared_ptr<Type> target_type;
+    Type* target_type;
     IRValue value;
-
-    IRCast(std::shared_ptr<Type> n_target_type, IRValue n_value) :
-        IR(IROptype::typecast), target_type(n_target_type), value(n_value) {}
+    UnaryKernel kernel;
+
+    IRCast(Type* n_target_type, IRValue n_value) :
+        IR(IROptype::typecast), target_type(n_target_type), value(n_value),
+        kernel(select_cast_kernel(ir_kind_of(n_value.value_type), ir_kind_of(n_target_type))) {
+        if (!kernel) {
+            throw std::runtime_error("Invalid cast from " + n_value.value_type->get_type_name() +
+                " to " + n_target_type->get_type_name());
+        }
+    }
 
     virtual void print(std::string prefix) override {
         std::cout << prefix;
@@ -529,17 +834,64 @@ public:
         std::cout << "> TO " << target_type->get_type_name();
     }
 
-    virtual std::shared_ptr<Type> result_type() override {
+    virtual Type* result_type() override {
         return target_type;
     }
 
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        visit(value);
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRCast>(*this);
+    }
+
+    virtual void run(FunctionContext*) override;
+};
+
+// Value of a variable where control flow joins: the value it held at the
+// end of whichever predecessor was left. Phis live between construct_ssa
+// and destruct_ssa only, the engines never see one.
+class IRPhi : public IR {
+public:
+    Type* value_type;
+    // bid of the predecessor, value on the edge from it
+    std::vector<std::pair<int, IRValue>> incoming;
+
+    IRPhi(Type* n_value_type) :
+        IR(IROptype::phi), value_type(n_value_type) {}
+
+    virtual void print(std::string prefix) override {
+        std::cout << prefix;
+        std::cout << ir_optype_to_str(type);
+        for (auto &edge : incoming) {
+            std::cout << " [b" << edge.first << ' ' << '<';
+            edge.second.print();
+            std::cout << '>' << ']';
+        }
+    }
+
+    virtual Type* result_type() override {
+        return value_type;
+    }
+
+    virtual void visit_operands(const std::function<void(IRValue&)> &visit) override {
+        for (auto &edge : incoming) {
+            visit(edge.second);
+        }
+    }
+
+    virtual IR* clone(Arena &arena) const override {
+        return arena.make<IRPhi>(*this);
+    }
+
     virtual void run(FunctionContext*) override;
 };
 
 class IRBlock {
 public:
     int bid;
-    std::vector<std::shared_ptr<IR>> statements;
+    std::vector<IR*> statements;
     IRJump jump;
 
     IRBlock(int n_bid) : bid(n_bid) { }
@@ -551,29 +903,94 @@ public:
 
 class IRFunction {
 public:
-    std::shared_ptr<Type> return_type;
-    std::string func_name;
-    std::map<int, std::shared_ptr<IRBlock>> body;
-    std::map<std::string, std::shared_ptr<Type>> type_tables;
+    Type* return_type;
+    Symbol func_name;
+    // owns the blocks and instructions of the function
+    Arena arena;
+    // indexed by bid
+    std::vector<IRBlock*> body;
+    std::map<Symbol, Type*> type_tables;
+    std::map<Symbol, int> slot_tables;
     std::vector<IRValue> decl_vec;
     std::vector<IRValue> arg_vec;
+    int slot_count = 0;
+    // literal operands, with their runtime values built once at codegen
+    std::vector<IRLiteral> constants;
+    std::vector<Value> constant_values;
+    std::map<std::pair<Type*, uint64_t>, int> constant_index;
 
     IRFunction(
-        std::string n_func_name,
-        std::shared_ptr<Type> n_return_type
+        Symbol n_func_name,
+        Type* n_return_type
     ) : func_name(n_func_name), return_type(n_return_type) {
-        body[0] = std::make_shared<IRBlock>(0);
+        body.push_back(arena.make<IRBlock>(0));
+    }
+
+    int add_slot() {
+        if (slot_count == IRValue::max_slot) {
+            throw std::runtime_error("Too many values in " + SymbolTable::global().get(func_name));
+        }
+        return slot_count++;
+    }
+
+    // arguments and declarations share one slot per name
+    int declare_slot(Symbol n_name) {
+        auto it = slot_tables.find(n_name);
+        if (it != slot_tables.end()) {
+            return it->second;
+        }
+        int slot = add_slot();
+        slot_tables[n_name] = slot;
+        return slot;
     }
 
     void add_arg(IRValue n_value) {
+        n_value.set_slot(declare_slot(n_value.get_symbol()));
         arg_vec.push_back(n_value);
     }
 
     void add_decl(IRValue n_value) {
+        n_value.set_slot(declare_slot(n_value.get_symbol()));
         decl_vec.push_back(n_value);
     }
 
-    void add_type(std::string n_name, std::shared_ptr<Type> decl_type) {
+    // a local no identifier can reach, for values generated code merges;
+    // locals sharing a name share a type
+    IRValue add_hidden_decl(Symbol n_name, Type* decl_type) {
+        add_type(n_name, decl_type);
+        IRValue value(IROpearndType::id, decl_type, add_slot(), n_name);
+        decl_vec.push_back(value);
+        return value;
+    }
+
+    IRValue add_constant(const IRLiteral &literal, Value value) {
+        auto key = std::make_pair(literal.value_type, value.i);
+        auto it = constant_index.find(key);
+        int index;
+        if (it != constant_index.end()) {
+            index = it->second;
+        } else {
+            index = static_cast<int>(constants.size());
+            constants.push_back(literal);
+            constant_values.push_back(value);
+            constant_index[key] = index;
+        }
+        return IRValue::from_constant(literal.value_type, index);
+    }
+
+    // pool constant of an arithmetic type
+    IRValue add_constant(Type* type, Value value) {
+        switch (ir_kind_of(type)) {
+        case IRKind::f32:
+            return add_constant(IRLiteral::from_double(value.f, type), value);
+        case IRKind::f64:
+            return add_constant(IRLiteral::from_double(value.d, type), value);
+        default:
+            return add_constant(IRLiteral::from_int(value.i, type), value);
+        }
+    }
+
+    void add_type(Symbol n_name, Type* decl_type) {
         type_tables.insert(std::make_pair(n_name, decl_type));
     }
 
@@ -581,7 +998,7 @@ public:
 
     virtual void print(std::string prefix) {
         std::cout << prefix;
-        std::cout << func_name << '(';
+        std::cout << SymbolTable::global().get(func_name) << '(';
         std::cout << ')' << '\n';
 
         for(auto arg : arg_vec) {
@@ -593,48 +1010,30 @@ public:
             std::cout << "decl " <<
             " "  << decl.to_string() << '\n';
         }
+
+        for(std::size_t i = 0; i < constants.size(); i++) {
+            std::cout << "const " << '$' << i <<
+            " "  << constants[i].to_string() << '\n';
+        }
     };
 };
 
 class CodeGenContext {
 public:
-    std::map<std::string, std::shared_ptr<IRFunction>> func_defs;
-    std::shared_ptr<IRFunction> cur_function;
-    std::shared_ptr<IRBlock> cur_block;
-
-    IRValue generate_temp() {
-        return IRValue::from_bid(
-            cur_function->type_tables,
-            cur_block->bid,
-            cur_block->statements.size() - 1
-        );
+    std::map<Symbol, std::shared_ptr<IRFunction>> func_defs;
+    // strings of the whole program, referenced by handle at runtime
+    StringTable strings;
+
+    // function bodies are generated concurrently, this is the one table
+    // they all write to
+    uint32_t intern_string(const std::string &str) {
+        std::lock_guard<std::mutex> lock(strings_mutex);
+        return strings.intern(str);
     }
 
-    int append_block() {
-        int new_bid = cur_block->bid + 1;
-        cur_block = std::make_shared<IRBlock>(new_bid);
-        cur_function->body[new_bid] = cur_block;
-        return new_bid;
-    }
-
-    IRValue append_statement(std::shared_ptr<IR> new_ir) {
-        cur_block->statements.push_back(new_ir);
-        int index = cur_block->statements.size();
-        auto return_type = new_ir->result_type();
-        auto return_value = IRValue(
-            IROpearndType::temp,
-            return_type,
-            TempOperand {
-                cur_block->bid,
-                index - 1
-            }
-        );
-        cur_function->add_type(return_value.to_string(), return_type);
-        return return_value;
-    }
-
-    std::shared_ptr<IRFunction> find_func_by_name(std::string &name) {
-        return func_defs[name];
+    std::shared_ptr<IRFunction> find_func_by_name(Symbol name) {
+        auto it = func_defs.find(name);
+        return it == func_defs.end() ? nullptr : it->second;
     }
 
     void print() {
@@ -647,9 +1046,9 @@ public:
                 for(std::size_t index = 0; index < block_p->statements.size(); index++) { 
                     auto cur_ir = block_p->statements[index];
                     auto prefix = std::string("\t<") +
-                        cur_ir->result_type()->get_type_name() + ' ' +
-                        std::to_string(bid) + ':' +
-                        std::to_string(index) + ">: ";
+                        cur_ir->result_type()->get_type_name() +
+                        (cur_ir->result_slot >= 0 ? " %" + std::to_string(cur_ir->result_slot) : std::string()) +
+                        ">: ";
                     block_p->statements[index]->print(prefix);
                     std::cout << '\n';
                 }
@@ -658,6 +1057,125 @@ public:
             }
         }
     }
+
+private:
+    std::mutex strings_mutex;
+};
+
+// Code generation state of one function body. Every function is declared
+// in the context before any body is generated, so each body gets its own
+// builder and the bodies may be generated on separate threads.
+class FunctionBuilder {
+public:
+    CodeGenContext &module;
+    std::shared_ptr<IRFunction> cur_function;
+    IRBlock* cur_block;
+    // blocks ending in a `break`, one list per enclosing loop or switch;
+    // they jump to where it ends once that block exists
+    std::vector<std::vector<IRBlock*>> break_blocks;
+
+    FunctionBuilder(CodeGenContext &n_module, std::shared_ptr<IRFunction> n_function) :
+        module(n_module), cur_function(n_function), cur_block(n_function->body[0]) { }
+
+    // instructions live as long as the function being built
+    template <typename T, typename... Args>
+    T* make(Args&&... args) {
+        return cur_function->arena.make<T>(std::forward<Args>(args)...);
+    }
+
+    IRValue make_constant(const IRLiteral &literal) {
+        Value value {};
+        if (auto int_value = std::get_if<uint64_t>(&literal.value)) {
+            value = Value::from_int(*int_value);
+        } else if (auto double_value = std::get_if<double>(&literal.value)) {
+            if (ir_kind_of(literal.value_type) == IRKind::f32) {
+                value = Value::from_float(static_cast<float>(*double_value));
+            } else {
+                value = Value::from_double(*double_value);
+            }
+        } else {
+            value = Value::from_string(module.intern_string(std::get<std::string>(literal.value)));
+        }
+        return cur_function->add_constant(literal, value);
+    }
+
+    // result type of the usual arithmetic conversions of C, nullptr if the
+    // operands are not both arithmetic
+    Type* common_type(Type* lhs, Type* rhs) {
+        auto lhs_kind = ir_kind_of(lhs), rhs_kind = ir_kind_of(rhs);
+        auto is_arithmetic = [](IRKind kind) {
+            return kind != IRKind::none && kind != IRKind::ptr && kind != IRKind::str;
+        };
+        if (!is_arithmetic(lhs_kind) || !is_arithmetic(rhs_kind)) {
+            return nullptr;
+        }
+        auto &types = TypeContext::global();
+        if (lhs_kind == IRKind::f64 || rhs_kind == IRKind::f64) {
+            return types.get_float_type(64);
+        }
+        if (lhs_kind == IRKind::f32 || rhs_kind == IRKind::f32) {
+            return types.get_float_type(32);
+        }
+        if (lhs_kind == IRKind::i64 || rhs_kind == IRKind::i64) {
+            return types.get_integer_type(64);
+        }
+        return types.get_integer_type(32);
+    }
+
+    // converts between arithmetic types; constants are folded into the pool
+    IRValue convert(const IRValue &value, Type* target_type) {
+        if (value.value_type == target_type || !common_type(value.value_type, target_type)) {
+            return value;
+        }
+        auto kernel = select_cast_kernel(ir_kind_of(value.value_type), ir_kind_of(target_type));
+        if (value.type == IROpearndType::constant) {
+            Value result = kernel(cur_function->constant_values[value.get_constant_index()]);
+            return cur_function->add_constant(target_type, result);
+        }
+        return append_statement(make<IRCast>(target_type, value));
+    }
+
+    // an operation on two constants is folded into the pool as well, but
+    // an integer division by 0 or -1 may trap and is left for run time
+    IRValue append_binary(IROptype op, const IRValue &lhs, const IRValue &rhs) {
+        auto binary = make<IRBinary>(op, lhs, rhs);
+        if (lhs.type != IROpearndType::constant || rhs.type != IROpearndType::constant) {
+            return append_statement(binary);
+        }
+        auto &values = cur_function->constant_values;
+        Value rhs_value = values[rhs.get_constant_index()];
+        bool is_integer = binary->kind != IRKind::f32 && binary->kind != IRKind::f64;
+        auto divisor = static_cast<int64_t>(rhs_value.i);
+        if (op == IROptype::divide && is_integer && (divisor == 0 || divisor == -1)) {
+            return append_statement(binary);
+        }
+        Value result = binary->kernel(values[lhs.get_constant_index()], rhs_value);
+        return cur_function->add_constant(binary->result_type(), result);
+    }
+
+    IRValue generate_temp() {
+        if (cur_block->statements.empty()) {
+            return IRValue(IROpearndType::unknown_operand, TypeContext::global().get_void_type());
+        }
+        auto last_ir = cur_block->statements.back();
+        return IRValue::from_temp(last_ir->result_type(), last_ir->result_slot);
+    }
+
+    int append_block() {
+        int new_bid = static_cast<int>(cur_function->body.size());
+        cur_block = make<IRBlock>(new_bid);
+        cur_function->body.push_back(cur_block);
+        return new_bid;
+    }
+
+    IRValue append_statement(IR* new_ir) {
+        cur_block->statements.push_back(new_ir);
+        auto return_type = new_ir->result_type();
+        if (return_type->type_id != Type::TypeID::VoidTyID) {
+            new_ir->result_slot = cur_function->add_slot();
+        }
+        return IRValue::from_temp(return_type, new_ir->result_slot);
+    }
 };
 
 #endif
\ No newline at end of file
@@ -6,67 +6,104 @@
 #include <variant>
 
 #include <memory>
+#include <optional>
+#include <algorithm>
+#include <charconv>
+#include <type_traits>
+#include <string_view>
 
+#include "arena.hpp"
 #include "ir.hpp"
 
-class CodeGenContext;
+// value of an integer constant token, in decimal, octal or hex
+inline long long parse_integer(std::string_view text) {
+    int base = 10;
+    if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        base = 16;
+        text.remove_prefix(2);
+    } else if (text.size() > 1 && text[0] == '0') {
+        base = 8;
+        text.remove_prefix(1);
+    }
+    long long value = 0;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value, base);
+    if (result.ec != std::errc()) {
+        throw std::runtime_error("Invalid constant " + std::string(text));
+    }
+    return value;
+}
+
+class FunctionBuilder;
 class NStatement;
 class NExpression;
 class NVariableDeclaration;
 
-typedef std::vector<std::shared_ptr<NStatement>> StatementList;
-typedef std::vector<std::shared_ptr<NExpression>> ExpressionList;
-typedef std::vector<std::shared_ptr<NVariableDeclaration>> VariableList;
+typedef std::vector<NStatement*> StatementList;
+typedef std::vector<NExpression*> ExpressionList;
+typedef std::vector<NVariableDeclaration*> VariableList;
+
+// 1-based position of a node in the source, 0 when unknown
+struct SourceLocation {
+    int line = 0, column = 0;
+
+    std::string to_string() const {
+        return std::to_string(line) + ':' + std::to_string(column);
+    }
+};
 
 class Node {
 public:
+    SourceLocation location;
     virtual ~Node() {}
     virtual void print() {}
 };
 
 class NExpression : public Node {
 public:
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) = 0;
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) = 0;
 };
 
 class NStatement : public Node {
 public:
-    virtual void codeGen(CodeGenContext& context) = 0;
+    virtual void codeGen(FunctionBuilder& context) = 0;
 };
 
 class NIdentifier : public NExpression {
 public:
-    int pointer_level;
-    std::shared_ptr<std::string> name;
-    int array_size;
+    int pointer_level = 0;
+    Symbol name;
+    int array_size = 0;
 
-    NIdentifier(std::shared_ptr<std::string> n_name) : name(n_name) { }
+    NIdentifier(Symbol n_name) : name(n_name) { }
 
     virtual void print() {
         for(int i = 0; i < pointer_level; i++) {
             std::cout << "*";
         }
-        if (name)
-            std::cout << *name;
+        std::cout << SymbolTable::global().get(name);
         if (array_size) {
             std::cout << '[' << array_size << ']';
         }
     }
 
-    std::string get_name() {
-        return *name;
+    Symbol get_name() {
+        return name;
     }
 
-    IRValue to_ir(CodeGenContext& context) {
+    IRValue to_ir(FunctionBuilder& context) {
+        if (!context.cur_function->slot_tables.count(name)) {
+            throw std::runtime_error(location.to_string() + ": Undeclared identifier " + SymbolTable::global().get(name));
+        }
         return IRValue::from_operand(
             context.cur_function->type_tables,
-            *name
+            context.cur_function->slot_tables,
+            name
         );
     }
 
     virtual ~NIdentifier() { }
 
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
         auto ir_value = to_ir(context);
         return ir_value;
         // if (is_lvalue || ir_value.value_type->type_id != Type::TypeID::PointerTyID) {
@@ -116,37 +153,37 @@ public:
         std::cout << to_string();
     }
 
-    virtual std::shared_ptr<Type> result_type(NIdentifier &id) {
-        std::shared_ptr<Type> type_ptr;
+    virtual Type* result_type(NIdentifier &id) {
+        Type* type_ptr;
         switch (type)
         {
         case 293 :
-            type_ptr = std::make_shared<IntegerType>(32);
+            type_ptr = TypeContext::global().get_integer_type(32);
             break;
         case 297 :
-            type_ptr = std::make_shared<FloatType>(32);
+            type_ptr = TypeContext::global().get_float_type(32);
             break;
         case 294 :
-            type_ptr = std::make_shared<IntegerType>(64);
+            type_ptr = TypeContext::global().get_integer_type(64);
             break;
         case 299 :
-            type_ptr = std::make_shared<VoidType>();
+            type_ptr = TypeContext::global().get_void_type();
             break;
         case 298:
-            type_ptr = std::make_shared<FloatType>(64);
+            type_ptr = TypeContext::global().get_float_type(64);
             break;
         case 291 :
-            type_ptr = std::make_shared<IntegerType>(8);
+            type_ptr = TypeContext::global().get_integer_type(8);
             break;
         default:
-            type_ptr = std::make_shared<VoidType>();
+            type_ptr = TypeContext::global().get_void_type();
             break;
         }
         for(int i = 0; i < id.pointer_level; i++) {
-            type_ptr = std::make_shared<PointerType>(type_ptr);
+            type_ptr = TypeContext::global().get_pointer_type(type_ptr);
         }
         if (id.array_size > 0) {
-            type_ptr = std::make_shared<ArrayType>(id.array_size, type_ptr);
+            type_ptr = TypeContext::global().get_array_type(static_cast<size_t>(id.array_size), type_ptr);
         }
         return type_ptr;
     }
@@ -210,6 +247,12 @@ public:
         case 290 : //GT_OP
             return IROptype::greater;
             break;
+        case 267 : //LE_OP
+            return IROptype::less_equal;
+            break;
+        case 268 : //GE_OP
+            return IROptype::greater_equal;
+            break;
         case 263 : //INC_OP
             return IROptype::inc;
             break;
@@ -237,22 +280,28 @@ public:
         std::cout << " <const: " << value << "> ";
     }
     virtual ~NInteger() {}
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
-        return IRValue::from_int(value);
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
+        // literals are int unless the value needs a long
+        auto &types = TypeContext::global();
+        bool fits = value >= INT32_MIN && value <= INT32_MAX;
+        return context.make_constant(IRLiteral::from_int(
+            static_cast<uint64_t>(value),
+            fits ? types.get_integer_type(32) : types.get_integer_type(64)
+        ));
     }
 };
 
 class NStringLiteral : public NExpression {
 public:
-    std::shared_ptr<std::string> string_literal;
-    NStringLiteral(std::shared_ptr<std::string> n_string_literal) : 
+    std::string string_literal;
+    NStringLiteral(std::string n_string_literal) :
         string_literal(n_string_literal) {}
     virtual void print() {
-        std::cout << *string_literal;
+        std::cout << string_literal;
     }
     virtual ~NStringLiteral() {}
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
-        return IRValue::from_literal_string(*string_literal);
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
+        return context.make_constant(IRLiteral::from_string(string_literal));
     }
 };
 
@@ -260,47 +309,57 @@ public:
 // public:
 //     double value;
 //     NDouble(double value) : value(value) { }
-//     virtual IR* codeGen(CodeGenContext& context);
+//     virtual IR* codeGen(FunctionBuilder& context);
 // };
 
 class NMethodCall : public NExpression {
 public:
-    std::shared_ptr<NIdentifier> id;
-    std::shared_ptr<ExpressionList> arguments;
-    NMethodCall(std::shared_ptr<NIdentifier> n_id) : id(n_id) { }
-    NMethodCall(std::shared_ptr<NIdentifier> n_id, std::shared_ptr<ExpressionList> n_arguments) :
-        id(n_id), arguments(n_arguments) { }
+    NIdentifier* id = nullptr;
+    ExpressionList arguments;
+    NMethodCall(NIdentifier* n_id) : id(n_id) { }
+    NMethodCall(NIdentifier* n_id, ExpressionList n_arguments) :
+        id(n_id), arguments(std::move(n_arguments)) { }
     virtual void print() {
         id->print();
         std::cout << '(';
-        for(auto it = arguments->begin(); it != arguments->end(); it++) {
+        for(auto it = arguments.begin(); it != arguments.end(); it++) {
             (*it)->print();
             std::cout << ", ";
         }
         std::cout << ')';
     }
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
-        std::string name = id->get_name();
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
+        static const Symbol printf_name = SymbolTable::global().intern("printf");
+        Symbol name = id->get_name();
 
         // generation of operand IR
         std::vector<IRValue> operand_arguments;
-        for(auto it = arguments->begin(); it != arguments->end(); it++) {
+        for(auto it = arguments.begin(); it != arguments.end(); it++) {
             operand_arguments.push_back((*it)->codeGen(context, false));
         }
 
         // generation of function call IR
-        std::shared_ptr<IR> new_ir;
-        if (name == std::string("printf")) {
-            new_ir = std::make_shared<IRPrintf>(
+        IR* new_ir;
+        if (name == printf_name) {
+            new_ir = context.make<IRPrintf>(
                 operand_arguments
             );
         } else {
-            auto func = context.find_func_by_name(name);
-            new_ir = std::make_shared<IRMethodCall>(
+            // every function of the program is declared by now
+            auto func = context.module.find_func_by_name(name);
+            if (!func) {
+                throw std::runtime_error(location.to_string() + ": Undefined function " + SymbolTable::global().get(name));
+            }
+            for (size_t i = 0; i < operand_arguments.size() && i < func->arg_vec.size(); i++) {
+                operand_arguments[i] = context.convert(operand_arguments[i], func->arg_vec[i].value_type);
+            }
+            auto call = context.make<IRMethodCall>(
                 func->return_type,
                 name,
                 operand_arguments
             );
+            call->resolve(func.get());
+            new_ir = call;
         }
 
         // return current SSA variable
@@ -310,14 +369,14 @@ public:
 
 class NBinaryOperator : public NExpression {
 public:
-    std::shared_ptr<NExpression> lhs;
+    NExpression* lhs = nullptr;
     NOpType op;
-    std::shared_ptr<NExpression> rhs;
+    NExpression* rhs = nullptr;
 
     NBinaryOperator(
-        std::shared_ptr<NExpression> n_lhs,
+        NExpression* n_lhs,
         int n_op,
-        std::shared_ptr<NExpression> n_rhs
+        NExpression* n_rhs
     ) : lhs(n_lhs), op(n_op), rhs(n_rhs) { }
 
     virtual void print() {
@@ -331,32 +390,86 @@ public:
 
     virtual ~NBinaryOperator() { }
 
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
         auto lhs_value = lhs->codeGen(context, false);
         auto rhs_value = rhs->codeGen(context, false);
-        if(lhs_value.value_type->type_id != rhs_value.value_type->type_id) {
-            rhs_value = context.append_statement(
-                std::make_shared<IRCast>(
-                    lhs_value.value_type,
-                    rhs_value
-                )
-            );
+        auto operand_type = context.common_type(lhs_value.value_type, rhs_value.value_type);
+        if (!operand_type) {
+            throw std::runtime_error(location.to_string() + ": Invalid operands to " + op.to_string());
         }
-        return context.append_statement(
-            std::make_shared<IRBinary>(
+        lhs_value = context.convert(lhs_value, operand_type);
+        rhs_value = context.convert(rhs_value, operand_type);
+        return context.append_binary(op.to_optype(), lhs_value, rhs_value);
+    };
+};
+
+// `&&` and `||`: the right operand runs only when the left one leaves
+// the result open. Both paths store 0 or 1 into a hidden local, which SSA
+// construction turns into a phi where they meet.
+class NLogicalOperator : public NExpression {
+public:
+    NExpression* lhs = nullptr;
+    NOpType op;
+    NExpression* rhs = nullptr;
+
+    NLogicalOperator(
+        NExpression* n_lhs,
+        int n_op,
+        NExpression* n_rhs
+    ) : lhs(n_lhs), op(n_op), rhs(n_rhs) { }
+
+    virtual void print() {
+        lhs->print();
+        std::cout << " ";
+        op.print();
+        std::cout << " ";
+        rhs->print();
+        std::cout << " ";
+    }
+
+    virtual ~NLogicalOperator() { }
+
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
+        bool is_and = op.to_optype() == IROptype::land;
+        auto int_type = TypeContext::global().get_integer_type(32);
+        auto result = context.cur_function->add_hidden_decl(
+            SymbolTable::global().intern(is_and ? "&&" : "||"), int_type);
+
+        IRValue lhs_value = lhs->codeGen(context, false);
+        context.append_statement(context.make<IRBinary>(IROptype::assign, result,
+            context.make_constant(IRLiteral::from_int(is_and ? 0 : 1, int_type))));
+        IRBlock* lhs_blk = context.cur_block;
+
+        // rhs blk, reached when the left operand does not decide
+        int rhs_bid = context.append_block();
+        IRValue rhs_value = rhs->codeGen(context, false);
+        auto operand_type = context.common_type(lhs_value.value_type, rhs_value.value_type);
+        if (!operand_type) {
+            throw std::runtime_error(location.to_string() + ": Invalid operands to " + op.to_string());
+        }
+        auto rhs_result = context.append_statement(
+            context.make<IRBinary>(
                 op.to_optype(),
-                lhs_value,
-                rhs_value
+                context.convert(lhs_value, operand_type),
+                context.convert(rhs_value, operand_type)
             )
         );
+        context.append_statement(context.make<IRBinary>(IROptype::assign, result, rhs_result));
+        IRBlock* rhs_blk = context.cur_block;
+
+        int new_bid = context.append_block();
+        lhs_blk->jump = is_and ? IRJump::from_cond_jump(lhs_value, rhs_bid, new_bid) :
+            IRJump::from_cond_jump(lhs_value, new_bid, rhs_bid);
+        rhs_blk->jump = IRJump::from_direct_jump(new_bid);
+        return result;
     };
 };
 
 class NUnaryOperator : public NExpression {
 public:
     NOpType op;
-    std::shared_ptr<NExpression> lhs;
-    NUnaryOperator(std::shared_ptr<NExpression> n_lhs, int n_op) :
+    NExpression* lhs = nullptr;
+    NUnaryOperator(NExpression* n_lhs, int n_op) :
         lhs(n_lhs), op(n_op) { }
     virtual void print() {
         op.print();
@@ -364,9 +477,9 @@ public:
         lhs->print();
     }
     virtual ~NUnaryOperator() { }
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
         return context.append_statement(
-            std::make_shared<IRUnary>(
+            context.make<IRUnary>(
                 op.to_optype(),
                 lhs->codeGen(context, false)
             )
@@ -376,10 +489,10 @@ public:
 
 class NArrayIndex : public NExpression {
 public:
-    std::shared_ptr<NExpression> lhs;
-    std::shared_ptr<NExpression> rhs;
-    NArrayIndex(std::shared_ptr<NExpression> n_lhs,
-        std::shared_ptr<NExpression> n_rhs) : 
+    NExpression* lhs = nullptr;
+    NExpression* rhs = nullptr;
+    NArrayIndex(NExpression* n_lhs,
+        NExpression* n_rhs) : 
         lhs(n_lhs), rhs(n_rhs) { }
 
     virtual void print() {
@@ -391,9 +504,9 @@ public:
 
     virtual ~NArrayIndex() { }
 
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
         auto index_value = context.append_statement(
-            std::make_shared<IRArrayIndex>(
+            context.make<IRArrayIndex>(
                 lhs->codeGen(context, false),
                 rhs->codeGen(context, false)
             )
@@ -402,7 +515,7 @@ public:
             return index_value;
         } else {
             return context.append_statement(
-                std::make_shared<IRLoad>(
+                context.make<IRLoad>(
                     index_value
                 )
             );
@@ -412,11 +525,11 @@ public:
 
 class NAssignment : public NExpression {
 public:
-    std::shared_ptr<NExpression> lhs;
-    std::shared_ptr<NExpression> rhs;
+    NExpression* lhs = nullptr;
+    NExpression* rhs = nullptr;
 
-    NAssignment(std::shared_ptr<NExpression> n_lhs,
-        std::shared_ptr<NExpression> n_rhs) : 
+    NAssignment(NExpression* n_lhs,
+        NExpression* n_rhs) : 
         lhs(n_lhs), rhs(n_rhs) { }
 
     virtual void print() {
@@ -428,16 +541,18 @@ public:
 
     virtual ~NAssignment() { }
 
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
         IRValue lhs_value = lhs->codeGen(context, true),
             rhs_value = rhs->codeGen(context, false);
         if (lhs_value.value_type->type_id == Type::TypeID::PointerTyID) {
+            rhs_value = context.convert(rhs_value, lhs_value.value_type->get_element_type());
             return context.append_statement(
-                std::make_shared<IRStore>(lhs_value, rhs_value)
+                context.make<IRStore>(lhs_value, rhs_value)
             );
         } else {
+            rhs_value = context.convert(rhs_value, lhs_value.value_type);
             return context.append_statement(
-                std::make_shared<IRBinary>(IROptype::assign, lhs_value, rhs_value)
+                context.make<IRBinary>(IROptype::assign, lhs_value, rhs_value)
             );
         }
     };
@@ -449,25 +564,25 @@ public:
 //     NIdentifier& id;
 //     NDeclaration(const int &type, NIdentifier& id) : 
 //         type(type), id(id) { }
-//     virtual IR* codeGen(CodeGenContext& context);
+//     virtual IR* codeGen(FunctionBuilder& context);
 // };
 
 class NBlock : public NExpression {
 public:
-    std::shared_ptr<StatementList> statements = std::make_shared<StatementList>();
+    StatementList statements;
     NBlock() {}
-    void push_back(std::shared_ptr<NStatement> n_statement) {
-        statements->push_back(n_statement);
+    void push_back(NStatement* n_statement) {
+        statements.push_back(n_statement);
     }
     virtual void print() {
-        for(auto statement : *statements) {
+        for(auto statement : statements) {
             statement->print();
             std::cout << '\n';
         }
     }
     virtual ~NBlock() { }
-    virtual IRValue codeGen(CodeGenContext& context, bool is_lvalue) override {
-        for(auto it = statements->begin(); it != statements->end(); it++) {
+    virtual IRValue codeGen(FunctionBuilder& context, bool is_lvalue) override {
+        for(auto it = statements.begin(); it != statements.end(); it++) {
             (*it)->codeGen(context);
         }
         return context.generate_temp();
@@ -476,15 +591,15 @@ public:
 
 class NExpressionStatement : public NStatement {
 public:
-    std::shared_ptr<NExpression> expression;
-    NExpressionStatement(std::shared_ptr<NExpression> n_expression) : 
+    NExpression* expression = nullptr;
+    NExpressionStatement(NExpression* n_expression) : 
         expression(n_expression) { }
     virtual void print() {
         if(expression)
             expression->print();
     }
     virtual ~NExpressionStatement() { }
-    virtual void codeGen(CodeGenContext& context) {
+    virtual void codeGen(FunctionBuilder& context) {
         expression->codeGen(context, false);
     };
 };
@@ -492,12 +607,12 @@ public:
 class NVariableDeclaration : public NStatement {
 public:
     NType type;
-    std::shared_ptr<NIdentifier> id;
-    std::shared_ptr<NExpression> assign;
-    NVariableDeclaration(int n_type, std::shared_ptr<NIdentifier> n_id) :
+    NIdentifier* id = nullptr;
+    NExpression* assign = nullptr;
+    NVariableDeclaration(int n_type, NIdentifier* n_id) :
         type(n_type), id(n_id) { }
-    NVariableDeclaration(int n_type, std::shared_ptr<NIdentifier> n_id,
-        std::shared_ptr<NExpression> n_assign) :
+    NVariableDeclaration(int n_type, NIdentifier* n_id,
+        NExpression* n_assign) :
         type(n_type), id(n_id), assign(n_assign) { }
     virtual void print() {
         type.print();
@@ -512,22 +627,24 @@ public:
         }
     }
     virtual ~NVariableDeclaration() { }
-    virtual void codeGen(CodeGenContext& context) {
+    virtual void codeGen(FunctionBuilder& context) {
         if(!id) return;
         auto id_value = *id;
         context.cur_function->add_decl(
             IRValue (
                 IROpearndType::id,
                 type.result_type(id_value),
-                Operand { id_value.get_name() }
+                -1,
+                id_value.get_name()
             )
         );
         context.cur_function->add_type(id_value.get_name(), type.result_type(id_value));
         if (assign) {
             IRValue assign_value = assign->codeGen(context, false);
+            assign_value = context.convert(assign_value, type.result_type(id_value));
             IRValue lhs = id->to_ir(context);
             context.append_statement(
-                std::make_shared<IRBinary>(IROptype::assign, lhs, assign_value)
+                context.make<IRBinary>(IROptype::assign, lhs, assign_value)
             );
         }
     };
@@ -535,46 +652,80 @@ public:
 
 class NVariableDeclarationList : public NStatement {
 public:
-    std::shared_ptr<VariableList> var_list;
-    NVariableDeclarationList(std::shared_ptr<VariableList> n_var_list) :
-        var_list(n_var_list) { }
+    VariableList var_list;
+    NVariableDeclarationList() { }
 
-    void push_back(std::shared_ptr<NVariableDeclaration> n_var) {
-        var_list->push_back(n_var);
+    void push_back(NVariableDeclaration* n_var) {
+        var_list.push_back(n_var);
     }
 
     void set_type(int type) {
-        for(auto it = var_list->begin(); it != var_list->end(); it++) {
+        for(auto it = var_list.begin(); it != var_list.end(); it++) {
             (*it)->type = type;
         }
     }
 
     virtual void print() override {
-        for(auto var: *var_list) {
+        for(auto var: var_list) {
             var->print();
             std::cout << '\n';
         }
     }
 
-    virtual void codeGen(CodeGenContext& context) override {
-       for(auto it = var_list->begin(); it != var_list->end(); it++) {
+    virtual void codeGen(FunctionBuilder& context) override {
+       for(auto it = var_list.begin(); it != var_list.end(); it++) {
             (*it)->codeGen(context);
        }
     }
 };
 
+// Lays a loop out rotated: the condition is tested once on the way in,
+// unless the body runs first, and again at the bottom of every trip, so
+// an iteration ends in a single branch back to the top of the body. A
+// missing condition is always true.
+inline void gen_rotated_loop(FunctionBuilder& context, NExpression* condition,
+        NBlock* block, NExpression* increment, bool test_first) {
+    auto test = [&]() {
+        return condition ? condition->codeGen(context, false) :
+            context.make_constant(IRLiteral::from_int(1, TypeContext::global().get_integer_type(32)));
+    };
+
+    std::optional<IRValue> guard_value;
+    if (test_first) {
+        guard_value = test();
+    }
+    IRBlock* guard_blk = context.cur_block;
+
+    // body blk, ending in the increment and the condition
+    int body_bid = context.append_block();
+    context.break_blocks.emplace_back();
+    block->codeGen(context, false);
+    if (increment) {
+        increment->codeGen(context, false);
+    }
+    IRValue cond_value = test();
+    IRBlock* latch_blk = context.cur_block;
+
+    int new_bid = context.append_block();
+    guard_blk->jump = guard_value ? IRJump::from_cond_jump(*guard_value, body_bid, new_bid) :
+        IRJump::from_direct_jump(body_bid);
+    latch_blk->jump = IRJump::from_cond_jump(cond_value, body_bid, new_bid);
+    for (auto break_blk : context.break_blocks.back()) {
+        break_blk->jump = IRJump::from_direct_jump(new_bid);
+    }
+    context.break_blocks.pop_back();
+}
+
 class NForStatement: public NStatement{
 public:
-    std::shared_ptr<NBlock>  block;
-    std::shared_ptr<NExpression> initial, condition, increment;
+    NBlock* block = nullptr;
+    NExpression *initial = nullptr, *condition = nullptr, *increment = nullptr;
 
     NForStatement(){}
 
-    NForStatement(std::shared_ptr<NBlock> b, std::shared_ptr<NExpression> init = nullptr, std::shared_ptr<NExpression> cond = nullptr, std::shared_ptr<NExpression> incre = nullptr)
+    // a missing condition is always true
+    NForStatement(NBlock* b, NExpression* init = nullptr, NExpression* cond = nullptr, NExpression* incre = nullptr)
             : block(b), initial(init), condition(cond), increment(incre){
-        if( condition == nullptr ){
-            condition = std::make_shared<NInteger>(1);
-        }
     }
 
     virtual void print() override {
@@ -593,57 +744,49 @@ public:
         block->print();
     }
 
-    virtual void codeGen(CodeGenContext& context) override {
-        std::shared_ptr<IRBlock> orig_blk, init_blk, cond_blk, inc_blk, body_blk;
-        orig_blk = context.cur_block;
-
-        // init blk
-        int init_bid = context.append_block();
-        initial->codeGen(context, false);
-
-        init_blk = context.cur_block;
-        orig_blk->jump = IRJump::from_direct_jump(init_bid);
-
-        // cond blk
-        int cond_bid = context.append_block();
-        IRValue cond_value = condition->codeGen(context, false);
-
-        cond_blk = context.cur_block;
-        init_blk->jump = IRJump::from_direct_jump(cond_bid);
+    virtual void codeGen(FunctionBuilder& context) override {
+        if (initial) {
+            initial->codeGen(context, false);
+        }
+        gen_rotated_loop(context, condition, block, increment, true);
+    }
+};
 
-        // body blk
-        int body_bid = context.append_block();
-        block->codeGen(context, false);
+class NWhileStatement: public NStatement{
+public:
+    NExpression* condition = nullptr;
+    NBlock* block = nullptr;
+    // do-while: the body runs once before the first test
+    bool test_first = true;
 
-        body_blk = context.cur_block;
+    NWhileStatement(){}
 
-        // inc blk
-        if (increment) {
-            int inc_bid = context.append_block();
-            increment->codeGen(context, false);
-            inc_blk = context.cur_block;
+    NWhileStatement(NExpression* cond, NBlock* b, bool n_test_first = true)
+            : condition(cond), block(b), test_first(n_test_first){
+    }
 
-            body_blk->jump = IRJump::from_direct_jump(inc_bid);
-            inc_blk->jump = IRJump::from_direct_jump(cond_bid);
-        } else {
-            body_blk->jump = IRJump::from_direct_jump(cond_bid);
-        }
+    virtual void print() override {
+        std::cout << (test_first ? "while(" : "do while(");
+        condition->print();
+        std::cout << ")\n";
+        block->print();
+    }
 
-        int new_bid = context.append_block();
-        cond_blk->jump = IRJump::from_cond_jump(cond_value, body_bid, new_bid);
+    virtual void codeGen(FunctionBuilder& context) override {
+        gen_rotated_loop(context, condition, block, nullptr, test_first);
     }
 };
 
 class NIfStatement: public NStatement{
 public:
-    std::shared_ptr<NExpression>  condition;
-    std::shared_ptr<NBlock> true_block;          // should not be null
-    std::shared_ptr<NBlock> false_block;         // can be null
+    NExpression* condition = nullptr;
+    NBlock* true_block = nullptr;          // should not be null
+    NBlock* false_block = nullptr;         // can be null
 
 
     NIfStatement(){}
 
-    NIfStatement(std::shared_ptr<NExpression> cond, std::shared_ptr<NBlock> n_blk, std::shared_ptr<NBlock> n_blk2 = nullptr)
+    NIfStatement(NExpression* cond, NBlock* n_blk, NBlock* n_blk2 = nullptr)
         : condition(cond), true_block(n_blk), false_block(n_blk2){
     }
 
@@ -659,11 +802,11 @@ public:
         }
     }
 
-    virtual void codeGen(CodeGenContext& context) override {
+    virtual void codeGen(FunctionBuilder& context) override {
         // condition value
         IRValue cond_value = condition->codeGen(context, false);
-        std::shared_ptr<IRBlock> cond_block = context.cur_block,
-            true_block_p, false_block_p;
+        IRBlock *cond_block = context.cur_block,
+            *true_block_p, *false_block_p = nullptr;
         int true_bid, false_bid;
 
         // new block
@@ -691,13 +834,124 @@ public:
     }
 };
 
+// `case value:` or, without a value, `default:`, and the statements up
+// to the next label
+class NCaseClause : public Node {
+public:
+    NExpression* value = nullptr;
+    NBlock* block = nullptr;
+
+    NCaseClause(NExpression* n_value, NBlock* n_block)
+        : value(n_value), block(n_block) {
+    }
+
+    virtual void print() override {
+        if (value) {
+            std::cout << "case ";
+            value->print();
+            std::cout << ":\n";
+        } else {
+            std::cout << "default:\n";
+        }
+        block->print();
+    }
+};
+
+class NSwitchStatement: public NStatement{
+public:
+    NExpression* condition = nullptr;
+    std::vector<NCaseClause*> clauses;
+
+    NSwitchStatement(){}
+
+    void push_back(NCaseClause* n_clause) {
+        clauses.push_back(n_clause);
+    }
+
+    virtual void print() override {
+        std::cout << "switch(";
+        condition->print();
+        std::cout << ")\n";
+        for (auto clause : clauses) {
+            clause->print();
+        }
+    }
+
+    virtual void codeGen(FunctionBuilder& context) override {
+        IRValue value = condition->codeGen(context, false);
+        if (value.value_type->type_id != Type::TypeID::IntegerTyID) {
+            throw std::runtime_error(location.to_string() + ": Switch on a value that is not an integer");
+        }
+        IRBlock* switch_blk = context.cur_block;
+
+        // one block per clause, each falling through into the next
+        std::vector<std::pair<int64_t, int>> cases;
+        int default_bid = -1;
+        context.break_blocks.emplace_back();
+        for (auto clause : clauses) {
+            IRBlock* prev_blk = context.cur_block;
+            int clause_bid = context.append_block();
+            if (prev_blk != switch_blk) {
+                prev_blk->jump = IRJump::from_direct_jump(clause_bid);
+            }
+            if (clause->value) {
+                IRValue label = clause->value->codeGen(context, false);
+                if (label.type != IROpearndType::constant || label.value_type->type_id != Type::TypeID::IntegerTyID) {
+                    throw std::runtime_error(clause->location.to_string() + ": Case label is not an integer constant");
+                }
+                auto key = static_cast<int64_t>(context.cur_function->constant_values[label.get_constant_index()].i);
+                for (auto &item : cases) {
+                    if (item.first == key) {
+                        throw std::runtime_error(clause->location.to_string() + ": Duplicate case value " + std::to_string(key));
+                    }
+                }
+                cases.push_back({ key, clause_bid });
+            } else {
+                if (default_bid >= 0) {
+                    throw std::runtime_error(clause->location.to_string() + ": Multiple default labels");
+                }
+                default_bid = clause_bid;
+            }
+            clause->block->codeGen(context, false);
+        }
+        IRBlock* last_blk = context.cur_block;
+
+        int new_bid = context.append_block();
+        if (last_blk != switch_blk) {
+            last_blk->jump = IRJump::from_direct_jump(new_bid);
+        }
+        for (auto break_blk : context.break_blocks.back()) {
+            break_blk->jump = IRJump::from_direct_jump(new_bid);
+        }
+        context.break_blocks.pop_back();
+        switch_blk->jump = IRJump::from_switch_jump(value, cases, default_bid >= 0 ? default_bid : new_bid);
+    }
+};
+
+class NBreakStatement: public NStatement{
+public:
+    NBreakStatement(){}
+
+    virtual void print() override {
+        std::cout << "BREAK\n";
+    }
+
+    virtual void codeGen(FunctionBuilder& context) override {
+        if (context.break_blocks.empty()) {
+            throw std::runtime_error(location.to_string() + ": Break outside of a loop or switch");
+        }
+        context.break_blocks.back().push_back(context.cur_block);
+        context.append_block();
+    }
+};
+
 class NReturnStatement: public NStatement{
 public:
-    std::shared_ptr<NExpression> expression;
+    NExpression* expression = nullptr;
 
     NReturnStatement(){}
 
-    NReturnStatement(std::shared_ptr<NExpression>  n_expression = nullptr)
+    NReturnStatement(NExpression*  n_expression = nullptr)
             : expression(n_expression) {
     }
 
@@ -708,16 +962,11 @@ public:
         std::cout << '\n';
     }
 
-    virtual void codeGen(CodeGenContext& context) override {
-        IRValue ret_value = expression->codeGen(context, false);
-        if (ret_value.value_type->type_id != context.cur_function->return_type->type_id) {
-            ret_value = context.append_statement(
-                std::make_shared<IRCast>(
-                    context.cur_function->return_type,
-                    ret_value
-                )
-            );
-        }
+    virtual void codeGen(FunctionBuilder& context) override {
+        IRValue ret_value = context.convert(
+            expression->codeGen(context, false),
+            context.cur_function->return_type
+        );
         context.cur_block->jump = IRJump::from_ret_jump(ret_value);
         context.append_block();
     }
@@ -726,11 +975,11 @@ public:
 
 class NFunctionDeclaration : public NStatement {
 public:
-    std::shared_ptr<NIdentifier> name;
-    std::shared_ptr<NVariableDeclarationList> arguments;
+    NIdentifier* name = nullptr;
+    NVariableDeclarationList* arguments = nullptr;
 
-    NFunctionDeclaration(std::shared_ptr<NIdentifier> n_name,
-        std::shared_ptr<NVariableDeclarationList> n_arguments) :
+    NFunctionDeclaration(NIdentifier* n_name,
+        NVariableDeclarationList* n_arguments) :
         name(n_name), arguments(n_arguments) { }
 
     virtual void print() override {
@@ -743,8 +992,8 @@ public:
         std::cout << " ) " << '\n';
     }
 
-    virtual void codeGen(CodeGenContext& context) override {
-        for(auto it = arguments->var_list->begin(); it != arguments->var_list->end(); it++) {
+    virtual void codeGen(FunctionBuilder& context) override {
+        for(auto it = arguments->var_list.begin(); it != arguments->var_list.end(); it++) {
             auto var = *it;
             auto &id = var->id;
             auto &type = var->type;
@@ -754,7 +1003,8 @@ public:
                 IRValue (
                     IROpearndType::id,
                     type.result_type(id_value),
-                    Operand { id_value.get_name() }
+                    -1,
+                    id_value.get_name()
                 )
             );
             context.cur_function->add_type(id_value.get_name(), type.result_type(id_value));
@@ -765,11 +1015,11 @@ public:
 class NFunction : public NStatement {
 public:
     NType type;
-    std::shared_ptr<NFunctionDeclaration> func_decl;
-    std::shared_ptr<NBlock> block;
+    NFunctionDeclaration* func_decl = nullptr;
+    NBlock* block = nullptr;
     NFunction(int n_type,
-        std::shared_ptr<NFunctionDeclaration> n_func_decl, 
-        std::shared_ptr<NBlock> n_block) :
+        NFunctionDeclaration* n_func_decl, 
+        NBlock* n_block) :
         type(n_type), func_decl(n_func_decl), block(n_block) { }
 
     virtual void print() override {
@@ -778,18 +1028,32 @@ public:
         block->print();
     }
 
-    virtual void codeGen(CodeGenContext& context) override {
+    // adds the signature of the function to `module`; the body is
+    // generated later by codeGen
+    std::shared_ptr<IRFunction> declare(CodeGenContext& module) {
         auto func_id = *func_decl->name;
         auto func_name = func_id.get_name();
         std::shared_ptr<IRFunction> func_p =
             std::make_shared<IRFunction>(func_name, type.result_type(func_id));
 
-        context.cur_function = func_p;
-        context.cur_block = context.cur_function->body[0];
-        context.func_defs[func_name] = func_p;
-        func_decl->codeGen(context);
+        if (!module.func_defs.emplace(func_name, func_p).second) {
+            throw std::runtime_error(location.to_string() + ": Redefinition of function " + SymbolTable::global().get(func_name));
+        }
+        FunctionBuilder builder(module, func_p);
+        func_decl->codeGen(builder);
+        return func_p;
+    }
+
+    virtual void codeGen(FunctionBuilder& context) override {
         block->codeGen(context, false);
     }
 };
 
+// Everything the parser builds for one program. The nodes live in the
+// arena and are released with the unit.
+struct TranslationUnit {
+    Arena arena;
+    std::vector<NFunction*> functions;
+};
+
 #endif
\ No newline at end of file
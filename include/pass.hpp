@@ -0,0 +1,52 @@
+#ifndef SEMIC_PASS_HPP_INCLUDED
+#define SEMIC_PASS_HPP_INCLUDED
+
+#include "ir.hpp"
+
+// Transformations of one IRFunction. A pass touches nothing outside the
+// function it is given, so separate functions may be transformed on
+// separate threads.
+
+// Promotes the arithmetic variables of `func` to SSA values: assignments
+// to them disappear, their uses read the reaching definition, and phis
+// merge definitions where control flow joins. Pointers and arrays stay
+// in their slots.
+void construct_ssa(IRFunction &func);
+
+// Sparse conditional constant propagation over SSA form: temps proven
+// constant become pool constants, branches on them become jumps, and the
+// blocks no path reaches are left empty.
+void propagate_constants(IRFunction &func);
+
+// Global value numbering over SSA form: a computation repeated where its
+// first occurrence dominates is dropped and its uses read the first
+// result. Loads only match while no store or call may have intervened.
+void number_values(IRFunction &func);
+
+// Loop-invariant code motion over SSA form. Loops get a preheader where
+// they lack one, and instructions without side effects whose operands do
+// not change in the loop move into it, innermost loops first. Loads and
+// integer divisions move only from blocks that run on every trip, loads
+// only out of loops that neither store nor call.
+void hoist_loop_invariants(IRFunction &func);
+
+// Removes the instructions without side effects whose results nobody
+// reads, whole dead chains and cycles of phis included.
+void eliminate_dead_code(IRFunction &func);
+
+// Replaces every phi by copies into its slot at the end of each
+// predecessor, splitting edges that leave a block with several successors.
+void destruct_ssa(IRFunction &func);
+
+// Folds branches whose targets agree, jumps past empty blocks, merges a
+// block into its only predecessor when that ends in a jump to it, and
+// drops unreachable blocks. The rest are renumbered in reverse postorder.
+void simplify_cfg(IRFunction &func);
+
+// The one pass over the whole module, run on a single thread before the
+// passes above. Calls to small functions are replaced by a copy of the
+// callee's body, the size allowed growing with the loop depth of the
+// call; functions that may call themselves are never copied.
+void inline_functions(CodeGenContext &context);
+
+#endif
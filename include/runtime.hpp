@@ -0,0 +1,146 @@
+#ifndef SEMIC_RUNTIME_HPP_INCLUDED
+#define SEMIC_RUNTIME_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+// Bump allocator with stack discipline used for local arrays. The backing
+// storage never moves, so pointers handed to callees stay valid while the
+// owning frame is alive.
+class StackAllocator {
+public:
+    static constexpr size_t alignment = 16;
+
+    StackAllocator(size_t n_capacity) :
+        capacity(n_capacity), top(0), memory(new char[n_capacity]) {}
+
+    size_t mark() const {
+        return top;
+    }
+
+    void release(size_t n_mark) {
+        top = n_mark;
+    }
+
+    void* allocate(size_t size) {
+        size_t begin = (top + alignment - 1) & ~(alignment - 1);
+        if (begin + size > capacity) {
+            throw std::runtime_error("stack overflow");
+        }
+        top = begin + size;
+        void* result = memory.get() + begin;
+        memset(result, 0, size);
+        return result;
+    }
+
+private:
+    size_t capacity, top;
+    std::unique_ptr<char[]> memory;
+};
+
+// Strings referenced from runtime values by a 32-bit handle. Every distinct
+// string is stored once and handles stay valid for the table's lifetime.
+class StringTable {
+public:
+    uint32_t intern(std::string_view str) {
+        auto it = index.find(str);
+        if (it != index.end()) {
+            return it->second;
+        }
+        auto handle = static_cast<uint32_t>(strings.size());
+        strings.emplace_back(str);
+        index.emplace(strings.back(), handle);
+        return handle;
+    }
+
+    const std::string& get(uint32_t handle) const {
+        return strings[handle];
+    }
+
+private:
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, uint32_t> index;
+};
+
+// Runtime value of the simulator. The tag records which union member is
+// live; values are copied around freely and never own memory.
+struct Value {
+    enum class Tag : uint8_t {
+        none,
+        integer,
+        float32,
+        float64,
+        pointer,
+        string,
+    };
+
+    union {
+        uint64_t i;
+        float f;
+        double d;
+        void* p;
+        uint32_t s;
+    };
+    Tag tag;
+
+    static Value from_int(uint64_t n_value) {
+        Value value {};
+        value.i = n_value;
+        value.tag = Tag::integer;
+        return value;
+    }
+
+    static Value from_float(float n_value) {
+        Value value {};
+        value.f = n_value;
+        value.tag = Tag::float32;
+        return value;
+    }
+
+    static Value from_double(double n_value) {
+        Value value {};
+        value.d = n_value;
+        value.tag = Tag::float64;
+        return value;
+    }
+
+    static Value from_pointer(void* n_value) {
+        Value value {};
+        value.p = n_value;
+        value.tag = Tag::pointer;
+        return value;
+    }
+
+    static Value from_string(uint32_t n_handle) {
+        Value value {};
+        value.s = n_handle;
+        value.tag = Tag::string;
+        return value;
+    }
+
+    bool is_true() const {
+        switch (tag) {
+        case Tag::float32:
+            return f != 0.0f;
+        case Tag::float64:
+            return d != 0.0;
+        case Tag::pointer:
+            return p != nullptr;
+        default:
+            return i != 0;
+        }
+    }
+};
+
+static_assert(sizeof(Value) == 16, "Value should fit in two words");
+static_assert(std::is_trivially_copyable_v<Value>, "Value must be trivially copyable");
+
+#endif
@@ -1,142 +1,2850 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+// A Bison parser, made by GNU Bison 3.8.2.
 
-/* Bison interface for Yacc-like parsers in C
+// Skeleton interface for Bison LALR(1) parsers in C++
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
-   Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
-   This program is free software: you can redistribute it and/or modify
-   it under the terms of the GNU General Public License as published by
-   the Free Software Foundation, either version 3 of the License, or
-   (at your option) any later version.
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
 
-   This program is distributed in the hope that it will be useful,
-   but WITHOUT ANY WARRANTY; without even the implied warranty of
-   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-   GNU General Public License for more details.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
 
-   You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
-/* As a special exception, you may create a larger work that contains
-   part or all of the Bison parser skeleton and distribute that work
-   under terms of your choice, so long as that work isn't itself a
-   parser generator using the skeleton or a modified version thereof
-   as a parser skeleton.  Alternatively, if you modify or redistribute
-   the parser skeleton itself, you may (at your option) remove this
-   special exception, which will cause the skeleton and the resulting
-   Bison output files to be licensed under the GNU General Public
-   License without this special exception.
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
 
-   This special exception was added by the Free Software Foundation in
-   version 2.2 of Bison.  */
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
 
-#ifndef YY_YY_SEMIC_GRAMMAR_HPP_INCLUDED
-# define YY_YY_SEMIC_GRAMMAR_HPP_INCLUDED
+/**
+ ** \file ../include/semic_grammar.hpp
+ ** Define the yy::parser class.
+ */
+
+// C++ LALR(1) parser skeleton written by Akim Demaille.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+#ifndef YY_YY_INCLUDE_SEMIC_GRAMMAR_HPP_INCLUDED
+# define YY_YY_INCLUDE_SEMIC_GRAMMAR_HPP_INCLUDED
+// "%code requires" blocks.
+#line 7 "semic.y"
+
+#include <string_view>
+#include <vector>
+#include "node.hpp"
+
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+
+#line 60 "../include/semic_grammar.hpp"
+
+
+# include <cstdlib> // std::abort
+# include <iostream>
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
+
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
 /* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
 #endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    IDENTIFIER = 258,
-    CONSTANT = 259,
-    STRING_LITERAL = 260,
-    SIZEOF = 261,
-    PTR_OP = 262,
-    INC_OP = 263,
-    DEC_OP = 264,
-    LEFT_OP = 265,
-    RIGHT_OP = 266,
-    LE_OP = 267,
-    GE_OP = 268,
-    EQ_OP = 269,
-    NE_OP = 270,
-    AND_OP = 271,
-    OR_OP = 272,
-    MUL_ASSIGN = 273,
-    DIV_ASSIGN = 274,
-    MOD_ASSIGN = 275,
-    ADD_ASSIGN = 276,
-    SUB_ASSIGN = 277,
-    LEFT_ASSIGN = 278,
-    RIGHT_ASSIGN = 279,
-    AND_ASSIGN = 280,
-    XOR_ASSIGN = 281,
-    OR_ASSIGN = 282,
-    TYPE_NAME = 283,
-    NEG_OP = 284,
-    ADD_OP = 285,
-    MUL_OP = 286,
-    DIV_OP = 287,
-    MOD_OP = 288,
-    LT_OP = 289,
-    GT_OP = 290,
-    CHAR = 291,
-    SHORT = 292,
-    INT = 293,
-    LONG = 294,
-    SIGNED = 295,
-    UNSIGNED = 296,
-    FLOAT = 297,
-    DOUBLE = 298,
-    VOID = 299,
-    CASE = 300,
-    DEFAULT = 301,
-    IF = 302,
-    ELSE = 303,
-    SWITCH = 304,
-    WHILE = 305,
-    DO = 306,
-    FOR = 307,
-    GOTO = 308,
-    CONTINUE = 309,
-    BREAK = 310,
-    RETURN = 311
+
+namespace yy {
+#line 195 "../include/semic_grammar.hpp"
+
+
+  /// A point in a source file.
+  class position
+  {
+  public:
+    /// Type for file name.
+    typedef const std::string filename_type;
+    /// Type for line and column numbers.
+    typedef int counter_type;
+
+    /// Construct a position.
+    explicit position (filename_type* f = YY_NULLPTR,
+                       counter_type l = 1,
+                       counter_type c = 1)
+      : filename (f)
+      , line (l)
+      , column (c)
+    {}
+
+
+    /// Initialization.
+    void initialize (filename_type* fn = YY_NULLPTR,
+                     counter_type l = 1,
+                     counter_type c = 1)
+    {
+      filename = fn;
+      line = l;
+      column = c;
+    }
+
+    /** \name Line and Column related manipulators
+     ** \{ */
+    /// (line related) Advance to the COUNT next lines.
+    void lines (counter_type count = 1)
+    {
+      if (count)
+        {
+          column = 1;
+          line = add_ (line, count, 1);
+        }
+    }
+
+    /// (column related) Advance to the COUNT next columns.
+    void columns (counter_type count = 1)
+    {
+      column = add_ (column, count, 1);
+    }
+    /** \} */
+
+    /// File name to which this position refers.
+    filename_type* filename;
+    /// Current line number.
+    counter_type line;
+    /// Current column number.
+    counter_type column;
+
+  private:
+    /// Compute max (min, lhs+rhs).
+    static counter_type add_ (counter_type lhs, counter_type rhs, counter_type min)
+    {
+      return lhs + rhs < min ? min : lhs + rhs;
+    }
+  };
+
+  /// Add \a width columns, in place.
+  inline position&
+  operator+= (position& res, position::counter_type width)
+  {
+    res.columns (width);
+    return res;
+  }
+
+  /// Add \a width columns.
+  inline position
+  operator+ (position res, position::counter_type width)
+  {
+    return res += width;
+  }
+
+  /// Subtract \a width columns, in place.
+  inline position&
+  operator-= (position& res, position::counter_type width)
+  {
+    return res += -width;
+  }
+
+  /// Subtract \a width columns.
+  inline position
+  operator- (position res, position::counter_type width)
+  {
+    return res -= width;
+  }
+
+  /** \brief Intercept output stream redirection.
+   ** \param ostr the destination output stream
+   ** \param pos a reference to the position to redirect
+   */
+  template <typename YYChar>
+  std::basic_ostream<YYChar>&
+  operator<< (std::basic_ostream<YYChar>& ostr, const position& pos)
+  {
+    if (pos.filename)
+      ostr << *pos.filename << ':';
+    return ostr << pos.line << '.' << pos.column;
+  }
+
+  /// Two points in a source file.
+  class location
+  {
+  public:
+    /// Type for file name.
+    typedef position::filename_type filename_type;
+    /// Type for line and column numbers.
+    typedef position::counter_type counter_type;
+
+    /// Construct a location from \a b to \a e.
+    location (const position& b, const position& e)
+      : begin (b)
+      , end (e)
+    {}
+
+    /// Construct a 0-width location in \a p.
+    explicit location (const position& p = position ())
+      : begin (p)
+      , end (p)
+    {}
+
+    /// Construct a 0-width location in \a f, \a l, \a c.
+    explicit location (filename_type* f,
+                       counter_type l = 1,
+                       counter_type c = 1)
+      : begin (f, l, c)
+      , end (f, l, c)
+    {}
+
+
+    /// Initialization.
+    void initialize (filename_type* f = YY_NULLPTR,
+                     counter_type l = 1,
+                     counter_type c = 1)
+    {
+      begin.initialize (f, l, c);
+      end = begin;
+    }
+
+    /** \name Line and Column related manipulators
+     ** \{ */
+  public:
+    /// Reset initial location to final location.
+    void step ()
+    {
+      begin = end;
+    }
+
+    /// Extend the current location to the COUNT next columns.
+    void columns (counter_type count = 1)
+    {
+      end += count;
+    }
+
+    /// Extend the current location to the COUNT next lines.
+    void lines (counter_type count = 1)
+    {
+      end.lines (count);
+    }
+    /** \} */
+
+
+  public:
+    /// Beginning of the located region.
+    position begin;
+    /// End of the located region.
+    position end;
   };
+
+  /// Join two locations, in place.
+  inline location&
+  operator+= (location& res, const location& end)
+  {
+    res.end = end.end;
+    return res;
+  }
+
+  /// Join two locations.
+  inline location
+  operator+ (location res, const location& end)
+  {
+    return res += end;
+  }
+
+  /// Add \a width columns to the end position, in place.
+  inline location&
+  operator+= (location& res, location::counter_type width)
+  {
+    res.columns (width);
+    return res;
+  }
+
+  /// Add \a width columns to the end position.
+  inline location
+  operator+ (location res, location::counter_type width)
+  {
+    return res += width;
+  }
+
+  /// Subtract \a width columns to the end position, in place.
+  inline location&
+  operator-= (location& res, location::counter_type width)
+  {
+    return res += -width;
+  }
+
+  /// Subtract \a width columns to the end position.
+  inline location
+  operator- (location res, location::counter_type width)
+  {
+    return res -= width;
+  }
+
+  /** \brief Intercept output stream redirection.
+   ** \param ostr the destination output stream
+   ** \param loc a reference to the location to redirect
+   **
+   ** Avoid duplicate information.
+   */
+  template <typename YYChar>
+  std::basic_ostream<YYChar>&
+  operator<< (std::basic_ostream<YYChar>& ostr, const location& loc)
+  {
+    location::counter_type end_col
+      = 0 < loc.end.column ? loc.end.column - 1 : 0;
+    ostr << loc.begin;
+    if (loc.end.filename
+        && (!loc.begin.filename
+            || *loc.begin.filename != *loc.end.filename))
+      ostr << '-' << loc.end.filename << ':' << loc.end.line << '.' << end_col;
+    else if (loc.begin.line < loc.end.line)
+      ostr << '-' << loc.end.line << '.' << end_col;
+    else if (loc.begin.column < end_col)
+      ostr << '-' << end_col;
+    return ostr;
+  }
+
+
+  /// A Bison parser.
+  class parser
+  {
+  public:
+#ifdef YYSTYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define YYSTYPE in C++, use %define api.value.type"
+# endif
+    typedef YYSTYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
+  ///
+  /// Sort of a variant, but does not keep track of the nature
+  /// of the stored data, since that knowledge is available
+  /// via the current parser state.
+  class value_type
+  {
+  public:
+    /// Type of *this.
+    typedef value_type self_type;
+
+    /// Empty construction.
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
+    {}
+
+    /// Construct and fill.
+    template <typename T>
+    value_type (YY_RVREF (T) t)
+    {
+      new (yyas_<T> ()) T (YY_MOVE (t));
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
 #endif
 
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-union YYSTYPE
-{
-#line 20 "semic.y"
+    /// Destruction, allowed only if empty.
+    ~value_type () YY_NOEXCEPT
+    {}
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
+    /// Instantiate an empty \a T in here.
+    template <typename T>
+    T&
+    emplace ()
+    {
+      return *new (yyas_<T> ()) T ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    template <typename T>
+    T&
+    emplace (const T& t)
+    {
+      return *new (yyas_<T> ()) T (t);
+    }
+# endif
+
+    /// Instantiate an empty \a T in here.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build ()
+    {
+      return emplace<T> ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build (const T& t)
+    {
+      return emplace<T> (t);
+    }
 
-    Node *node;
-    NBlock *block;
-    NExpression *expr;
-    NStatement *stmt;
-    NIdentifier *ident;
-    NFunctionDeclaration *func_decl;
-	NFunction *func;
-    NVariableDeclaration *var_decl;
-    NVariableDeclarationList *var_list;
-    ExpressionList *expr_list;
-    std::string *string;
-    int token;
-    int pointer_level;
+    /// Accessor to a built \a T.
+    template <typename T>
+    T&
+    as () YY_NOEXCEPT
+    {
+      return *yyas_<T> ();
+    }
 
-#line 130 "semic_grammar.hpp"
+    /// Const accessor to a built \a T (for %printer).
+    template <typename T>
+    const T&
+    as () const YY_NOEXCEPT
+    {
+      return *yyas_<T> ();
+    }
 
-};
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
+    /// Swap the content with \a that, of same type.
+    ///
+    /// Both variants must be built beforehand, because swapping the actual
+    /// data requires reading it (with as()), and this is not possible on
+    /// unconstructed variants: it would require some dynamic testing, which
+    /// should not be the variant's responsibility.
+    /// Swapping between built and (possibly) non-built is done with
+    /// self_type::move ().
+    template <typename T>
+    void
+    swap (self_type& that) YY_NOEXCEPT
+    {
+      std::swap (as<T> (), that.as<T> ());
+    }
+
+    /// Move the content of \a that to this.
+    ///
+    /// Destroys \a that.
+    template <typename T>
+    void
+    move (self_type& that)
+    {
+# if 201103L <= YY_CPLUSPLUS
+      emplace<T> (std::move (that.as<T> ()));
+# else
+      emplace<T> ();
+      swap<T> (that);
+# endif
+      that.destroy<T> ();
+    }
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Move the content of \a that to this.
+    template <typename T>
+    void
+    move (self_type&& that)
+    {
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
+    }
+#endif
+
+    /// Copy the content of \a that to this.
+    template <typename T>
+    void
+    copy (const self_type& that)
+    {
+      emplace<T> (that.as<T> ());
+    }
+
+    /// Destroy the stored \a T.
+    template <typename T>
+    void
+    destroy ()
+    {
+      as<T> ().~T ();
+    }
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
+    self_type& operator= (const self_type&);
 #endif
 
+    /// Accessor to raw memory as \a T.
+    template <typename T>
+    T*
+    yyas_ () YY_NOEXCEPT
+    {
+      void *yyp = yyraw_;
+      return static_cast<T*> (yyp);
+     }
+
+    /// Const accessor to raw memory as \a T.
+    template <typename T>
+    const T*
+    yyas_ () const YY_NOEXCEPT
+    {
+      const void *yyp = yyraw_;
+      return static_cast<const T*> (yyp);
+     }
+
+    /// An auxiliary type to compute the largest semantic type.
+    union union_type
+    {
+      // argument_expression_list
+      char dummy1[sizeof (ExpressionList)];
+
+      // statement_list
+      // compound_statement
+      char dummy2[sizeof (NBlock*)];
+
+      // switch_clause
+      char dummy3[sizeof (NCaseClause*)];
+
+      // primary_expression
+      // postfix_expression
+      // unary_expression
+      // cast_expression
+      // multiplicative_expression
+      // additive_expression
+      // shift_expression
+      // relational_expression
+      // equality_expression
+      // and_expression
+      // exclusive_or_expression
+      // inclusive_or_expression
+      // logical_and_expression
+      // logical_or_expression
+      // conditional_expression
+      // assignment_expression
+      // expression
+      // constant_expression
+      char dummy4[sizeof (NExpression*)];
+
+      // function_definition
+      char dummy5[sizeof (NFunction*)];
+
+      // func_declarator
+      char dummy6[sizeof (NFunctionDeclaration*)];
+
+      // declarator
+      // direct_declarator
+      char dummy7[sizeof (NIdentifier*)];
+
+      // declaration_statement
+      // expression_statement
+      // selection_statement
+      // iteration_statement
+      // jump_statement
+      // statement
+      char dummy8[sizeof (NStatement*)];
+
+      // switch_clause_list
+      char dummy9[sizeof (NSwitchStatement*)];
+
+      // init_declarator
+      // parameter_declaration
+      char dummy10[sizeof (NVariableDeclaration*)];
+
+      // declaration
+      // init_declarator_list
+      // parameter_list
+      char dummy11[sizeof (NVariableDeclarationList*)];
+
+      // IDENTIFIER
+      char dummy12[sizeof (Symbol)];
+
+      // SIZEOF
+      // PTR_OP
+      // INC_OP
+      // DEC_OP
+      // LEFT_OP
+      // RIGHT_OP
+      // LE_OP
+      // GE_OP
+      // EQ_OP
+      // NE_OP
+      // AND_OP
+      // OR_OP
+      // MUL_ASSIGN
+      // DIV_ASSIGN
+      // MOD_ASSIGN
+      // ADD_ASSIGN
+      // SUB_ASSIGN
+      // LEFT_ASSIGN
+      // RIGHT_ASSIGN
+      // AND_ASSIGN
+      // XOR_ASSIGN
+      // OR_ASSIGN
+      // TYPE_NAME
+      // NEG_OP
+      // ADD_OP
+      // MUL_OP
+      // DIV_OP
+      // MOD_OP
+      // LT_OP
+      // GT_OP
+      // CHAR
+      // SHORT
+      // INT
+      // LONG
+      // SIGNED
+      // UNSIGNED
+      // FLOAT
+      // DOUBLE
+      // VOID
+      // type_specifier
+      // pointer
+      char dummy13[sizeof (int)];
+
+      // CONSTANT
+      // STRING_LITERAL
+      char dummy14[sizeof (std::string_view)];
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+  };
+
+#endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
+    /// Symbol locations.
+    typedef location location_type;
+
+    /// Syntax errors thrown from user actions.
+    struct syntax_error : std::runtime_error
+    {
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
+      location_type location;
+    };
+
+    /// Token kinds.
+    struct token
+    {
+      enum token_kind_type
+      {
+        YYEMPTY = -2,
+    YYEOF = 0,                     // "end of file"
+    YYerror = 256,                 // error
+    YYUNDEF = 257,                 // "invalid token"
+    IDENTIFIER = 258,              // IDENTIFIER
+    CONSTANT = 259,                // CONSTANT
+    STRING_LITERAL = 260,          // STRING_LITERAL
+    SIZEOF = 261,                  // SIZEOF
+    PTR_OP = 262,                  // PTR_OP
+    INC_OP = 263,                  // INC_OP
+    DEC_OP = 264,                  // DEC_OP
+    LEFT_OP = 265,                 // LEFT_OP
+    RIGHT_OP = 266,                // RIGHT_OP
+    LE_OP = 267,                   // LE_OP
+    GE_OP = 268,                   // GE_OP
+    EQ_OP = 269,                   // EQ_OP
+    NE_OP = 270,                   // NE_OP
+    AND_OP = 271,                  // AND_OP
+    OR_OP = 272,                   // OR_OP
+    MUL_ASSIGN = 273,              // MUL_ASSIGN
+    DIV_ASSIGN = 274,              // DIV_ASSIGN
+    MOD_ASSIGN = 275,              // MOD_ASSIGN
+    ADD_ASSIGN = 276,              // ADD_ASSIGN
+    SUB_ASSIGN = 277,              // SUB_ASSIGN
+    LEFT_ASSIGN = 278,             // LEFT_ASSIGN
+    RIGHT_ASSIGN = 279,            // RIGHT_ASSIGN
+    AND_ASSIGN = 280,              // AND_ASSIGN
+    XOR_ASSIGN = 281,              // XOR_ASSIGN
+    OR_ASSIGN = 282,               // OR_ASSIGN
+    TYPE_NAME = 283,               // TYPE_NAME
+    NEG_OP = 284,                  // NEG_OP
+    ADD_OP = 285,                  // ADD_OP
+    MUL_OP = 286,                  // MUL_OP
+    DIV_OP = 287,                  // DIV_OP
+    MOD_OP = 288,                  // MOD_OP
+    LT_OP = 289,                   // LT_OP
+    GT_OP = 290,                   // GT_OP
+    CHAR = 291,                    // CHAR
+    SHORT = 292,                   // SHORT
+    INT = 293,                     // INT
+    LONG = 294,                    // LONG
+    SIGNED = 295,                  // SIGNED
+    UNSIGNED = 296,                // UNSIGNED
+    FLOAT = 297,                   // FLOAT
+    DOUBLE = 298,                  // DOUBLE
+    VOID = 299,                    // VOID
+    CASE = 300,                    // CASE
+    DEFAULT = 301,                 // DEFAULT
+    IF = 302,                      // IF
+    ELSE = 303,                    // ELSE
+    SWITCH = 304,                  // SWITCH
+    WHILE = 305,                   // WHILE
+    DO = 306,                      // DO
+    FOR = 307,                     // FOR
+    GOTO = 308,                    // GOTO
+    CONTINUE = 309,                // CONTINUE
+    BREAK = 310,                   // BREAK
+    RETURN = 311                   // RETURN
+      };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
+    };
+
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
+
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 67, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_IDENTIFIER = 3,                        // IDENTIFIER
+        S_CONSTANT = 4,                          // CONSTANT
+        S_STRING_LITERAL = 5,                    // STRING_LITERAL
+        S_SIZEOF = 6,                            // SIZEOF
+        S_PTR_OP = 7,                            // PTR_OP
+        S_INC_OP = 8,                            // INC_OP
+        S_DEC_OP = 9,                            // DEC_OP
+        S_LEFT_OP = 10,                          // LEFT_OP
+        S_RIGHT_OP = 11,                         // RIGHT_OP
+        S_LE_OP = 12,                            // LE_OP
+        S_GE_OP = 13,                            // GE_OP
+        S_EQ_OP = 14,                            // EQ_OP
+        S_NE_OP = 15,                            // NE_OP
+        S_AND_OP = 16,                           // AND_OP
+        S_OR_OP = 17,                            // OR_OP
+        S_MUL_ASSIGN = 18,                       // MUL_ASSIGN
+        S_DIV_ASSIGN = 19,                       // DIV_ASSIGN
+        S_MOD_ASSIGN = 20,                       // MOD_ASSIGN
+        S_ADD_ASSIGN = 21,                       // ADD_ASSIGN
+        S_SUB_ASSIGN = 22,                       // SUB_ASSIGN
+        S_LEFT_ASSIGN = 23,                      // LEFT_ASSIGN
+        S_RIGHT_ASSIGN = 24,                     // RIGHT_ASSIGN
+        S_AND_ASSIGN = 25,                       // AND_ASSIGN
+        S_XOR_ASSIGN = 26,                       // XOR_ASSIGN
+        S_OR_ASSIGN = 27,                        // OR_ASSIGN
+        S_TYPE_NAME = 28,                        // TYPE_NAME
+        S_NEG_OP = 29,                           // NEG_OP
+        S_ADD_OP = 30,                           // ADD_OP
+        S_MUL_OP = 31,                           // MUL_OP
+        S_DIV_OP = 32,                           // DIV_OP
+        S_MOD_OP = 33,                           // MOD_OP
+        S_LT_OP = 34,                            // LT_OP
+        S_GT_OP = 35,                            // GT_OP
+        S_CHAR = 36,                             // CHAR
+        S_SHORT = 37,                            // SHORT
+        S_INT = 38,                              // INT
+        S_LONG = 39,                             // LONG
+        S_SIGNED = 40,                           // SIGNED
+        S_UNSIGNED = 41,                         // UNSIGNED
+        S_FLOAT = 42,                            // FLOAT
+        S_DOUBLE = 43,                           // DOUBLE
+        S_VOID = 44,                             // VOID
+        S_CASE = 45,                             // CASE
+        S_DEFAULT = 46,                          // DEFAULT
+        S_IF = 47,                               // IF
+        S_ELSE = 48,                             // ELSE
+        S_SWITCH = 49,                           // SWITCH
+        S_WHILE = 50,                            // WHILE
+        S_DO = 51,                               // DO
+        S_FOR = 52,                              // FOR
+        S_GOTO = 53,                             // GOTO
+        S_CONTINUE = 54,                         // CONTINUE
+        S_BREAK = 55,                            // BREAK
+        S_RETURN = 56,                           // RETURN
+        S_57_ = 57,                              // '('
+        S_58_ = 58,                              // ')'
+        S_59_ = 59,                              // '['
+        S_60_ = 60,                              // ']'
+        S_61_ = 61,                              // ','
+        S_62_ = 62,                              // '='
+        S_63_ = 63,                              // ';'
+        S_64_ = 64,                              // '{'
+        S_65_ = 65,                              // '}'
+        S_66_ = 66,                              // ':'
+        S_YYACCEPT = 67,                         // $accept
+        S_primary_expression = 68,               // primary_expression
+        S_postfix_expression = 69,               // postfix_expression
+        S_argument_expression_list = 70,         // argument_expression_list
+        S_unary_expression = 71,                 // unary_expression
+        S_cast_expression = 72,                  // cast_expression
+        S_multiplicative_expression = 73,        // multiplicative_expression
+        S_additive_expression = 74,              // additive_expression
+        S_shift_expression = 75,                 // shift_expression
+        S_relational_expression = 76,            // relational_expression
+        S_equality_expression = 77,              // equality_expression
+        S_and_expression = 78,                   // and_expression
+        S_exclusive_or_expression = 79,          // exclusive_or_expression
+        S_inclusive_or_expression = 80,          // inclusive_or_expression
+        S_logical_and_expression = 81,           // logical_and_expression
+        S_logical_or_expression = 82,            // logical_or_expression
+        S_conditional_expression = 83,           // conditional_expression
+        S_assignment_expression = 84,            // assignment_expression
+        S_assignment_operator = 85,              // assignment_operator
+        S_expression = 86,                       // expression
+        S_constant_expression = 87,              // constant_expression
+        S_declaration = 88,                      // declaration
+        S_init_declarator_list = 89,             // init_declarator_list
+        S_init_declarator = 90,                  // init_declarator
+        S_type_specifier = 91,                   // type_specifier
+        S_declarator = 92,                       // declarator
+        S_direct_declarator = 93,                // direct_declarator
+        S_pointer = 94,                          // pointer
+        S_func_declarator = 95,                  // func_declarator
+        S_parameter_list = 96,                   // parameter_list
+        S_parameter_declaration = 97,            // parameter_declaration
+        S_declaration_statement = 98,            // declaration_statement
+        S_expression_statement = 99,             // expression_statement
+        S_selection_statement = 100,             // selection_statement
+        S_switch_clause_list = 101,              // switch_clause_list
+        S_switch_clause = 102,                   // switch_clause
+        S_iteration_statement = 103,             // iteration_statement
+        S_jump_statement = 104,                  // jump_statement
+        S_statement = 105,                       // statement
+        S_statement_list = 106,                  // statement_list
+        S_compound_statement = 107,              // compound_statement
+        S_translation_unit = 108,                // translation_unit
+        S_function_definition = 109              // function_definition
+      };
+    };
+
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
+
+    /// A complete symbol.
+    ///
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
+    ///
+    /// Provide access to semantic value and location.
+    template <typename Base>
+    struct basic_symbol : Base
+    {
+      /// Alias to Base.
+      typedef Base super_type;
+
+      /// Default constructor.
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        value.move< ExpressionList > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        value.move< NBlock* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        value.move< NCaseClause* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        value.move< NExpression* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        value.move< NFunction* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        value.move< NFunctionDeclaration* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        value.move< NIdentifier* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        value.move< NStatement* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        value.move< NSwitchStatement* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        value.move< NVariableDeclaration* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        value.move< NVariableDeclarationList* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        value.move< Symbol > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        value.move< int > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        value.move< std::string_view > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
+#endif
+
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ExpressionList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ExpressionList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NBlock*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NBlock*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NCaseClause*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NCaseClause*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NExpression*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NExpression*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NFunction*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NFunction*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NFunctionDeclaration*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NFunctionDeclaration*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NIdentifier*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NIdentifier*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NStatement*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NStatement*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NSwitchStatement*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NSwitchStatement*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NVariableDeclaration*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NVariableDeclaration*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, NVariableDeclarationList*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const NVariableDeclarationList*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, Symbol&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const Symbol& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const int& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string_view&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string_view& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+      /// Destroy the symbol.
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
+
+      /// Destroy contents, and record that is empty.
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        value.template destroy< ExpressionList > ();
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        value.template destroy< NBlock* > ();
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        value.template destroy< NCaseClause* > ();
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        value.template destroy< NExpression* > ();
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        value.template destroy< NFunction* > ();
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        value.template destroy< NFunctionDeclaration* > ();
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        value.template destroy< NIdentifier* > ();
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        value.template destroy< NStatement* > ();
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        value.template destroy< NSwitchStatement* > ();
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        value.template destroy< NVariableDeclaration* > ();
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        value.template destroy< NVariableDeclarationList* > ();
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        value.template destroy< Symbol > ();
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        value.template destroy< int > ();
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        value.template destroy< std::string_view > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+#if YYDEBUG || 0
+      /// The user-facing name of this symbol.
+      const char *name () const YY_NOEXCEPT
+      {
+        return parser::symbol_name (this->kind ());
+      }
+#endif // #if YYDEBUG || 0
+
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// Whether empty.
+      bool empty () const YY_NOEXCEPT;
+
+      /// Destructive move, \a s is emptied into this.
+      void move (basic_symbol& s);
+
+      /// The semantic value.
+      value_type value;
+
+      /// The location.
+      location_type location;
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment operator.
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
+    };
+
+    /// Type access provider for token (enum) based symbols.
+    struct by_kind
+    {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
+      /// Default constructor.
+      by_kind () YY_NOEXCEPT;
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
+
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
+
+      /// Constructor from (external) token numbers.
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
+
+      /// The (internal) type number (corresponding to \a type).
+      /// \a empty when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
+    };
+
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
+
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
+
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {}
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, Symbol v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const Symbol& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {}
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {}
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string_view v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string_view& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {}
+    };
+
+    /// Build a parser object.
+    parser (yyscan_t scanner_yyarg, TranslationUnit &unit_yyarg);
+    virtual ~parser ();
+
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    parser (const parser&) = delete;
+    /// Non copyable.
+    parser& operator= (const parser&) = delete;
+#endif
+
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
+
+    /// Parse.
+    /// \returns  0 iff parsing succeeded.
+    virtual int parse ();
+
+#if YYDEBUG
+    /// The current debugging stream.
+    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging stream.
+    void set_debug_stream (std::ostream &);
+
+    /// Type for debugging levels.
+    typedef int debug_level_type;
+    /// The current debugging level.
+    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging level.
+    void set_debug_level (debug_level_type l);
+#endif
+
+    /// Report a syntax error.
+    /// \param loc    where the syntax error is found.
+    /// \param msg    a description of the syntax error.
+    virtual void error (const location_type& loc, const std::string& msg);
+
+    /// Report a syntax error.
+    void error (const syntax_error& err);
+
+#if YYDEBUG || 0
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static const char *symbol_name (symbol_kind_type yysymbol);
+#endif // #if YYDEBUG || 0
+
+
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYEOF (location_type l)
+      {
+        return symbol_type (token::YYEOF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYEOF (const location_type& l)
+      {
+        return symbol_type (token::YYEOF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYerror (location_type l)
+      {
+        return symbol_type (token::YYerror, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYerror (const location_type& l)
+      {
+        return symbol_type (token::YYerror, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYUNDEF (location_type l)
+      {
+        return symbol_type (token::YYUNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYUNDEF (const location_type& l)
+      {
+        return symbol_type (token::YYUNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IDENTIFIER (Symbol v, location_type l)
+      {
+        return symbol_type (token::IDENTIFIER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IDENTIFIER (const Symbol& v, const location_type& l)
+      {
+        return symbol_type (token::IDENTIFIER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONSTANT (std::string_view v, location_type l)
+      {
+        return symbol_type (token::CONSTANT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONSTANT (const std::string_view& v, const location_type& l)
+      {
+        return symbol_type (token::CONSTANT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING_LITERAL (std::string_view v, location_type l)
+      {
+        return symbol_type (token::STRING_LITERAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING_LITERAL (const std::string_view& v, const location_type& l)
+      {
+        return symbol_type (token::STRING_LITERAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SIZEOF (int v, location_type l)
+      {
+        return symbol_type (token::SIZEOF, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SIZEOF (const int& v, const location_type& l)
+      {
+        return symbol_type (token::SIZEOF, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PTR_OP (int v, location_type l)
+      {
+        return symbol_type (token::PTR_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PTR_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::PTR_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INC_OP (int v, location_type l)
+      {
+        return symbol_type (token::INC_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INC_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::INC_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEC_OP (int v, location_type l)
+      {
+        return symbol_type (token::DEC_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEC_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::DEC_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEFT_OP (int v, location_type l)
+      {
+        return symbol_type (token::LEFT_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEFT_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::LEFT_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RIGHT_OP (int v, location_type l)
+      {
+        return symbol_type (token::RIGHT_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RIGHT_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::RIGHT_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LE_OP (int v, location_type l)
+      {
+        return symbol_type (token::LE_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LE_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::LE_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GE_OP (int v, location_type l)
+      {
+        return symbol_type (token::GE_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GE_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::GE_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EQ_OP (int v, location_type l)
+      {
+        return symbol_type (token::EQ_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EQ_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::EQ_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NE_OP (int v, location_type l)
+      {
+        return symbol_type (token::NE_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NE_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::NE_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_AND_OP (int v, location_type l)
+      {
+        return symbol_type (token::AND_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_AND_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::AND_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OR_OP (int v, location_type l)
+      {
+        return symbol_type (token::OR_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OR_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::OR_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MUL_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::MUL_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MUL_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::MUL_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DIV_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::DIV_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DIV_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::DIV_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MOD_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::MOD_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MOD_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::MOD_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ADD_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::ADD_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ADD_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::ADD_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::SUB_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::SUB_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEFT_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::LEFT_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEFT_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::LEFT_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RIGHT_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::RIGHT_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RIGHT_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::RIGHT_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_AND_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::AND_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_AND_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::AND_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_XOR_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::XOR_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_XOR_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::XOR_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OR_ASSIGN (int v, location_type l)
+      {
+        return symbol_type (token::OR_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OR_ASSIGN (const int& v, const location_type& l)
+      {
+        return symbol_type (token::OR_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPE_NAME (int v, location_type l)
+      {
+        return symbol_type (token::TYPE_NAME, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPE_NAME (const int& v, const location_type& l)
+      {
+        return symbol_type (token::TYPE_NAME, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEG_OP (int v, location_type l)
+      {
+        return symbol_type (token::NEG_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEG_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::NEG_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ADD_OP (int v, location_type l)
+      {
+        return symbol_type (token::ADD_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ADD_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::ADD_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MUL_OP (int v, location_type l)
+      {
+        return symbol_type (token::MUL_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MUL_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::MUL_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DIV_OP (int v, location_type l)
+      {
+        return symbol_type (token::DIV_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DIV_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::DIV_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MOD_OP (int v, location_type l)
+      {
+        return symbol_type (token::MOD_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MOD_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::MOD_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LT_OP (int v, location_type l)
+      {
+        return symbol_type (token::LT_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LT_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::LT_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GT_OP (int v, location_type l)
+      {
+        return symbol_type (token::GT_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GT_OP (const int& v, const location_type& l)
+      {
+        return symbol_type (token::GT_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CHAR (int v, location_type l)
+      {
+        return symbol_type (token::CHAR, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CHAR (const int& v, const location_type& l)
+      {
+        return symbol_type (token::CHAR, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SHORT (int v, location_type l)
+      {
+        return symbol_type (token::SHORT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SHORT (const int& v, const location_type& l)
+      {
+        return symbol_type (token::SHORT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INT (int v, location_type l)
+      {
+        return symbol_type (token::INT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INT (const int& v, const location_type& l)
+      {
+        return symbol_type (token::INT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LONG (int v, location_type l)
+      {
+        return symbol_type (token::LONG, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LONG (const int& v, const location_type& l)
+      {
+        return symbol_type (token::LONG, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SIGNED (int v, location_type l)
+      {
+        return symbol_type (token::SIGNED, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SIGNED (const int& v, const location_type& l)
+      {
+        return symbol_type (token::SIGNED, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UNSIGNED (int v, location_type l)
+      {
+        return symbol_type (token::UNSIGNED, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UNSIGNED (const int& v, const location_type& l)
+      {
+        return symbol_type (token::UNSIGNED, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (int v, location_type l)
+      {
+        return symbol_type (token::FLOAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const int& v, const location_type& l)
+      {
+        return symbol_type (token::FLOAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DOUBLE (int v, location_type l)
+      {
+        return symbol_type (token::DOUBLE, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DOUBLE (const int& v, const location_type& l)
+      {
+        return symbol_type (token::DOUBLE, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VOID (int v, location_type l)
+      {
+        return symbol_type (token::VOID, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VOID (const int& v, const location_type& l)
+      {
+        return symbol_type (token::VOID, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CASE (location_type l)
+      {
+        return symbol_type (token::CASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CASE (const location_type& l)
+      {
+        return symbol_type (token::CASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEFAULT (location_type l)
+      {
+        return symbol_type (token::DEFAULT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEFAULT (const location_type& l)
+      {
+        return symbol_type (token::DEFAULT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IF (location_type l)
+      {
+        return symbol_type (token::IF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IF (const location_type& l)
+      {
+        return symbol_type (token::IF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ELSE (location_type l)
+      {
+        return symbol_type (token::ELSE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ELSE (const location_type& l)
+      {
+        return symbol_type (token::ELSE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SWITCH (location_type l)
+      {
+        return symbol_type (token::SWITCH, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SWITCH (const location_type& l)
+      {
+        return symbol_type (token::SWITCH, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHILE (location_type l)
+      {
+        return symbol_type (token::WHILE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHILE (const location_type& l)
+      {
+        return symbol_type (token::WHILE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DO (location_type l)
+      {
+        return symbol_type (token::DO, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DO (const location_type& l)
+      {
+        return symbol_type (token::DO, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FOR (location_type l)
+      {
+        return symbol_type (token::FOR, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FOR (const location_type& l)
+      {
+        return symbol_type (token::FOR, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GOTO (location_type l)
+      {
+        return symbol_type (token::GOTO, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GOTO (const location_type& l)
+      {
+        return symbol_type (token::GOTO, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTINUE (location_type l)
+      {
+        return symbol_type (token::CONTINUE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTINUE (const location_type& l)
+      {
+        return symbol_type (token::CONTINUE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BREAK (location_type l)
+      {
+        return symbol_type (token::BREAK, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BREAK (const location_type& l)
+      {
+        return symbol_type (token::BREAK, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RETURN (location_type l)
+      {
+        return symbol_type (token::RETURN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RETURN (const location_type& l)
+      {
+        return symbol_type (token::RETURN, l);
+      }
+#endif
+
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    parser (const parser&);
+    /// Non copyable.
+    parser& operator= (const parser&);
+#endif
+
+
+    /// Stored state numbers (used for stacks).
+    typedef unsigned char state_type;
+
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
+
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
+
+    static const short yypact_ninf_;
+    static const signed char yytable_ninf_;
+
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
+
+#if YYDEBUG || 0
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
+#endif // #if YYDEBUG || 0
+
+
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
+
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const signed char yydefact_[];
+
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
+
+    // YYDEFGOTO[NTERM-NUM].
+    static const unsigned char yydefgoto_[];
+
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const unsigned char yytable_[];
+
+    static const short yycheck_[];
+
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const signed char yystos_[];
+
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const signed char yyr1_[];
+
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
+
+
+#if YYDEBUG
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
+    /// Report on the debug stream that the rule \a r is going to be reduced.
+    virtual void yy_reduce_print_ (int r) const;
+    /// Print the state stack on the debug stream.
+    virtual void yy_stack_print_ () const;
+
+    /// Debugging level.
+    int yydebug_;
+    /// Debug stream.
+    std::ostream* yycdebug_;
+
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
+
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
+
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
+
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
+
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
+
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
+
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
+
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
+
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
+
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
+
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
+
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
+
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
+
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
+
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
+
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
+
+
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
+
+    /// The stack.
+    stack_type yystack_;
+
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
+
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
+
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
+
+    /// Constants.
+    enum
+    {
+      yylast_ = 280,     ///< Last index in yytable_.
+      yynnts_ = 43,  ///< Number of nonterminal symbols.
+      yyfinal_ = 16 ///< Termination state number.
+    };
+
+
+    // User arguments.
+    yyscan_t scanner;
+    TranslationUnit &unit;
+
+  };
+
+
+} // yy
+#line 2846 "../include/semic_grammar.hpp"
+
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
 
-#endif /* !YY_YY_SEMIC_GRAMMAR_HPP_INCLUDED  */
+#endif // !YY_YY_INCLUDE_SEMIC_GRAMMAR_HPP_INCLUDED
@@ -6,339 +6,191 @@
 #include <map>
 #include <type_system.hpp>
 #include <cstring>
-#include <variant>
-#include <stack>
+#include <algorithm>
 
 #include "ir.hpp"
-
-typedef std::variant<void*, uint32_t, uint64_t, float, double, std::string> RegisterValue;
+#include "runtime.hpp"
 
 class Simulator; 
 
-class Register {
+// One activation record of the simulator. The values of a frame live in the
+// Simulator's slot stack starting at `base`; `slots` points there and is
+// refreshed whenever the stack grows.
+class FunctionContext {
 public:
-    std::shared_ptr<Type> type;
-    RegisterValue value;
-
-    std::shared_ptr<Register> run_binary_op(IROptype op, Register &rhs) {
-        auto result = std::make_shared<Register>();
-        switch (op) {
-        case IROptype::add:
-            result->type = type;
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = std::get<uint64_t>(value) + std::get<uint64_t>(rhs.value);
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = std::get<float>(value) + std::get<float>(rhs.value);
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = std::get<double>(value) + std::get<double>(rhs.value);
-            }
-            break;
-        case IROptype::minus:
-            result->type = type;
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = std::get<uint64_t>(value) - std::get<uint64_t>(rhs.value);
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = std::get<float>(value) - std::get<float>(rhs.value);
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = std::get<double>(value) - std::get<double>(rhs.value);
-            }
-            break;
-        case IROptype::mul:
-            result->type = type;
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = std::get<uint64_t>(value) * std::get<uint64_t>(rhs.value);
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = std::get<float>(value) * std::get<float>(rhs.value);
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = std::get<double>(value) * std::get<double>(rhs.value);
-            }
-            break;
-        case IROptype::divide:
-            result->type = type;
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = std::get<uint64_t>(value) / std::get<uint64_t>(rhs.value);
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = std::get<float>(value) / std::get<float>(rhs.value);
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = std::get<double>(value) / std::get<double>(rhs.value);
-            }
-            break;
-        case IROptype::land:
-            result->type = std::make_shared<IntegerType>(32);
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = (uint32_t)(std::get<uint64_t>(value) && std::get<uint64_t>(rhs.value));
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = (uint32_t)(std::get<float>(value) && std::get<float>(rhs.value));
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = (uint32_t)(std::get<double>(value) && std::get<double>(rhs.value));
-            }
-            break;
-        case IROptype::lor:
-            result->type = std::make_shared<IntegerType>(32);
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = (uint32_t)(std::get<uint64_t>(value) || std::get<uint64_t>(rhs.value));
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = (uint32_t)(std::get<float>(value) || std::get<float>(rhs.value));
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = (uint32_t)(std::get<double>(value) || std::get<double>(rhs.value));
-            }
-            break;
-        case IROptype::less:
-            result->type = std::make_shared<IntegerType>(32);
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = (uint32_t)(std::get<uint64_t>(value) < std::get<uint64_t>(rhs.value));
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = (uint32_t)(std::get<float>(value) < std::get<float>(rhs.value));
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = (uint32_t)(std::get<double>(value) < std::get<double>(rhs.value));
-            }
-            break;
-        case IROptype::greater:
-            result->type = std::make_shared<IntegerType>(32);
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = (uint32_t)(std::get<uint64_t>(value) > std::get<uint64_t>(rhs.value));
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = (uint32_t)(std::get<float>(value) > std::get<float>(rhs.value));
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = (uint32_t)(std::get<double>(value) > std::get<double>(rhs.value));
-            }
-            break;
-        case IROptype::less_equal:
-            result->type = std::make_shared<IntegerType>(32);
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = (uint32_t)(std::get<uint64_t>(value) <= std::get<uint64_t>(rhs.value));
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = (uint32_t)(std::get<float>(value) <= std::get<float>(rhs.value));
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = (uint32_t)(std::get<double>(value) <= std::get<double>(rhs.value));
-            }
-            break;
-        case IROptype::greater_equal:
-            result->type = std::make_shared<IntegerType>(32);
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = (uint32_t)(std::get<uint64_t>(value) >= std::get<uint64_t>(rhs.value));
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = (uint32_t)(std::get<float>(value) >= std::get<float>(rhs.value));
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = (uint32_t)(std::get<double>(value) >= std::get<double>(rhs.value));
-            }
-            break;
-        default:
-            // Handle other operations if needed
-            break;
-        }
-        return result;
-    }
+    int bid, index;
+    IRFunction* cur_function;
+    size_t base;
+    Value* slots;
+    Value return_value;
+    // slot of the caller that receives the return value
+    int return_slot;
+    size_t memory_mark;
+    Simulator* sim;
 
-    std::shared_ptr<Register> run_unary_op(IROptype op) {
-        auto result = std::make_shared<Register>();
-        switch (op) {
-        case IROptype::inc:
-            result->type = type;
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = std::get<uint64_t>(value) + 1;
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = std::get<float>(value) + 1.0f;
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = std::get<double>(value) + 1.0;
-            }
-            break;
-        case IROptype::dec:
-            result->type = type;
-            if (type->type_id == Type::TypeID::IntegerTyID) {
-                result->value = std::get<uint64_t>(value) - 1;
-            } else if (type->type_id == Type::TypeID::FloatTyID) {
-                result->value = std::get<float>(value) - 1.0f;
-            } else if (type->type_id == Type::TypeID::DoubleTyID) {
-                result->value = std::get<double>(value) - 1.0;
-            }
-            break;
-        default:
-            // Handle other operations if needed
-            break;
-        }
-        return result;
-    }
+    FunctionContext(IRFunction* n_func, size_t n_base, int n_return_slot, Simulator* n_sim) :
+        bid(0), index(0), cur_function(n_func), base(n_base), slots(nullptr),
+        return_value {}, return_slot(n_return_slot), memory_mark(0), sim(n_sim) {}
 
-    std::shared_ptr<Register> run_typecast_op(std::shared_ptr<Type> target_type) {
-        auto result = std::make_shared<Register>();
-        result->type = target_type;
-        // Implement typecast logic if needed
-        return result;
-    }
+    void initialize();
 
-    std::string to_string() const {
-        return std::visit([](auto&& val) -> std::string {
-            using T = std::decay_t<decltype(val)>;
-            if constexpr (std::is_same_v<T, void*>) {
-                return "void*";
-            } else if constexpr (std::is_same_v<T, uint32_t>) {
-                return std::to_string(val);
-            } else if constexpr (std::is_same_v<T, uint64_t>) {
-                return std::to_string(val);
-            } else if constexpr (std::is_same_v<T, float>) {
-                return std::to_string(val);
-            } else if constexpr (std::is_same_v<T, double>) {
-                return std::to_string(val);
-            } else if constexpr (std::is_same_v<T, std::string>) {
-                return val;
-            } else {
-                return "unknown";
-            }
-        }, value);
-    }
+    Value get_value(const IRValue &value);
 
-    void print() const {
-        std::cout << to_string();
+    void set_value(int slot, Value value) {
+        slots[slot] = value;
     }
 };
 
-class FunctionContext {
+class Simulator {
 public:
-    int bid, index;
-    std::shared_ptr<IRFunction> cur_function;
-    std::map<std::string, std::shared_ptr<Register>> symbol_table;
-    Simulator* sim;
+    // frames are laid out back to back in `stack`; a call pushes a frame and
+    // execution continues in the callee from the same loop
+    std::vector<FunctionContext> frames;
+    std::vector<Value> stack;
+    StackAllocator memory;
+    CodeGenContext* context;
 
-    FunctionContext(std::shared_ptr<IRFunction> n_func, Simulator* n_sim) :
-        cur_function(n_func), bid(0), index(0), sim(n_sim) {
-        initialize();
-    }
+    Simulator(CodeGenContext* ctx, size_t n_memory_size = 16 << 20) :
+        memory(n_memory_size), context(ctx) {}
 
-    void initialize() {
-        for (const auto& decl : cur_function->decl_vec) {
-            auto reg = std::make_shared<Register>();
-            reg->type = decl.value_type;
-            // 根据类型初始化变量
-            switch (decl.value_type->type_id) {
-            case Type::TypeID::IntegerTyID:
-                reg->value = uint64_t(0);
-                break;
-            case Type::TypeID::FloatTyID:
-                reg->value = float(0.0);
-                break;
-            case Type::TypeID::DoubleTyID:
-                reg->value = double(0.0);
-                break;
-            case Type::TypeID::StringTyID:
-                reg->value = std::string("");
-                break;
-            case Type::TypeID::ArrayTyID: {
-                auto new_alloc = static_cast<void*>(malloc(decl.value_type->get_size()));
-                memset(new_alloc, 0, decl.value_type->get_size());
-                reg->value = new_alloc;
-                break;
+    FunctionContext& push_frame(IRFunction* func, int return_slot) {
+        size_t base = frames.empty() ? 0 :
+            frames.back().base + static_cast<size_t>(frames.back().cur_function->slot_count);
+        size_t top = base + static_cast<size_t>(func->slot_count);
+        if (top > stack.size()) {
+            stack.resize(std::max(top, stack.size() * 2));
+            for (auto &frame : frames) {
+                frame.slots = stack.data() + frame.base;
             }
-            default:
-                reg->value = nullptr;
-                break;
-            }
-            symbol_table[decl.get_name()] = reg;
         }
+        frames.emplace_back(func, base, return_slot, this);
+        auto &frame = frames.back();
+        frame.slots = stack.data() + base;
+        frame.memory_mark = memory.mark();
+        frame.initialize();
+        return frame;
     }
 
-    bool step() {
-        while (true) {
-            auto cur_block = cur_function->body[bid];
-            if (index >= cur_block->statements.size()) {
-                cur_block->jump.run(this);
-                if (cur_block->jump.jump_type == IRJump::IRJumpType::ret) {
-                    return true;
-                }
-                continue;
-            }
-            auto cur_ir = cur_block->statements[index];
-            cur_ir->run(this);
-            index++;
-            if (cur_ir->type == IROptype::call) {
-                return false; // 切换到新函数上下文
-            }
+    void pop_frame() {
+        auto &frame = frames.back();
+        Value return_value = frame.return_value;
+        int return_slot = frame.return_slot;
+        bool has_value = frame.cur_function->return_type->type_id != Type::TypeID::VoidTyID;
+        memory.release(frame.memory_mark);
+        frames.pop_back();
+        if (!frames.empty() && has_value && return_slot >= 0) {
+            frames.back().set_value(return_slot, return_value);
         }
     }
 
-    std::shared_ptr<Register> get_value(IRValue value) {
-        switch (value.type)
-        {
-        case IROpearndType::id : {
-            Operand op_value = std::get<Operand>(value.operand);
-            return symbol_table[op_value.name];
-            break;
-        }
-        case IROpearndType::literal_double : {
-            double double_value = std::get<double>(value.operand);
-            auto reg = std::make_shared<Register>();
-            reg->type = std::make_shared<FloatType>(64);
-            reg->value = double_value;
-            return reg;
+    void print_value(Value value) {
+        switch (value.tag) {
+        case Value::Tag::integer:
+            std::cout << static_cast<int64_t>(value.i);
             break;
-        }
-        case IROpearndType::literal_int : {
-            uint64_t int_value = std::get<uint64_t>(value.operand);
-            auto reg = std::make_shared<Register>();
-            reg->type = std::make_shared<IntegerType>(64);
-            reg->value = int_value;
-            return reg;
+        case Value::Tag::float32:
+            std::cout << value.f;
             break;
-        }
-        case IROpearndType::literal_string : {
-            std::string str_value = std::get<std::string>(value.operand);
-            auto reg = std::make_shared<Register>();
-            reg->type = std::make_shared<StringType>();
-            reg->value = str_value;
-            return reg;
+        case Value::Tag::float64:
+            std::cout << value.d;
             break;
-        }
-        case IROpearndType::temp : {
-            TempOperand temp_value = std::get<TempOperand>(value.operand);
-            return symbol_table[std::to_string(temp_value.bid) + ':' + std::to_string(temp_value.index)];
+        case Value::Tag::pointer:
+            std::cout << value.p;
             break;
-        }
-        case IROpearndType::unknown_operand : {
-            return nullptr;
+        case Value::Tag::string:
+            std::cout << context->strings.get(value.s);
             break;
-        }
         default:
-            return nullptr;
+            break;
         }
     }
 
-    void set_temp_value(TempOperand temp, std::shared_ptr<Register> value) {
-        symbol_table[std::to_string(temp.bid) + ':' + std::to_string(temp.index)] = value;
-    }
-};
-
-class Simulator {
-public:
-    std::stack<std::shared_ptr<FunctionContext>> st;
-    CodeGenContext* context;
-
-    Simulator(CodeGenContext* ctx) : context(ctx) {}
-
-    void init_run() {
-        auto main_func = context->func_defs["main"];
-        auto start_context = std::make_shared<FunctionContext>(main_func, this);
-        st.push(start_context);
+    // arrays are printed element by element using their static type
+    void print_value(Value value, Type* type) {
+        if (!type || type->type_id != Type::TypeID::ArrayTyID) {
+            print_value(value);
+            return;
+        }
+        auto element_type = type->get_element_type();
+        auto element_size = element_type->get_size();
+        auto length = type->get_size() / element_size;
+        auto load = select_load_kernel(ir_kind_of(element_type));
+        std::cout << '[';
+        for (size_t j = 0; j < length; ++j) {
+            print_value(load(static_cast<char*>(value.p) + j * element_size));
+            if (j < length - 1) {
+                std::cout << ", ";
+            }
+        }
+        std::cout << ']';
     }
 
     void run() {
-        init_run();
-        while(!st.empty()) {
-            auto cur_context = st.top();
-            if(cur_context->step()){
-                if (cur_context->cur_function->return_type->type_id != Type::TypeID::VoidTyID) {
-                    auto return_value = cur_context->symbol_table["return"];
-                    st.pop();
-                    if (!st.empty()) {
-                        auto caller_context = st.top();
-                        TempOperand temp{caller_context->bid, caller_context->index - 1};
-                        caller_context->set_temp_value(temp, return_value);
-                    }
-                } else {
-                    st.pop();
+        auto main_func = context->find_func_by_name(SymbolTable::global().intern("main"));
+        if (!main_func) {
+            throw std::runtime_error("No main function");
+        }
+        push_frame(main_func.get(), -1);
+        while (!frames.empty()) {
+            auto &frame = frames.back();
+            auto &cur_block = frame.cur_function->body[static_cast<size_t>(frame.bid)];
+            if (frame.index >= static_cast<int>(cur_block->statements.size())) {
+                cur_block->jump.run(&frame);
+                if (cur_block->jump.jump_type == IRJump::IRJumpType::ret) {
+                    pop_frame();
                 }
+                continue;
             }
+            // advance first: a call pushes the callee and may move `frames`
+            auto &cur_ir = cur_block->statements[static_cast<size_t>(frame.index++)];
+            cur_ir->run(&frame);
         }
     }
 };
 
+inline void FunctionContext::initialize() {
+    std::fill(slots, slots + cur_function->slot_count, Value {});
+    for (const auto& decl : cur_function->decl_vec) {
+        Value value {};
+        // 根据类型初始化变量
+        switch (decl.value_type->type_id) {
+        case Type::TypeID::IntegerTyID:
+            value = Value::from_int(0);
+            break;
+        case Type::TypeID::FloatTyID:
+        case Type::TypeID::DoubleTyID:
+            if (ir_kind_of(decl.value_type) == IRKind::f64) {
+                value = Value::from_double(0.0);
+            } else {
+                value = Value::from_float(0.0f);
+            }
+            break;
+        case Type::TypeID::StringTyID:
+            value = Value::from_string(sim->context->strings.intern(""));
+            break;
+        case Type::TypeID::ArrayTyID: {
+            value = Value::from_pointer(sim->memory.allocate(decl.value_type->get_size()));
+            break;
+        }
+        default:
+            value = Value::from_pointer(nullptr);
+            break;
+        }
+        slots[decl.get_slot()] = value;
+    }
+}
+
+inline Value FunctionContext::get_value(const IRValue &value) {
+    switch (value.type)
+    {
+    case IROpearndType::id :
+    case IROpearndType::temp :
+        return slots[value.slot];
+    case IROpearndType::constant :
+        return cur_function->constant_values[value.get_constant_index()];
+    default:
+        return Value {};
+    }
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef SEMIC_SOURCE_HPP_INCLUDED
+#define SEMIC_SOURCE_HPP_INCLUDED
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Interned identifier. Two names are equal iff their symbols are.
+using Symbol = uint32_t;
+
+// Owns the spelling of every identifier of the program. The lexer interns
+// each identifier once; the AST, the IR and the engines only hold symbols.
+// Lookups lock a mutex and may be issued from several threads.
+class SymbolTable {
+public:
+    static SymbolTable& global() {
+        static SymbolTable table;
+        return table;
+    }
+
+    Symbol intern(std::string_view name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(name);
+        if (it != index.end()) {
+            return it->second;
+        }
+        auto symbol = static_cast<Symbol>(names.size());
+        names.emplace_back(name);
+        index.emplace(names.back(), symbol);
+        return symbol;
+    }
+
+    const std::string& get(Symbol symbol) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return names[symbol];
+    }
+
+private:
+    std::mutex mutex;
+    // deque keeps the strings in place, the index points into them
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, Symbol> index;
+
+    SymbolTable() {
+        // symbol 0 is the empty name of unnamed operands
+        intern("");
+    }
+};
+
+// Program text the lexer scans in place. Regular files are mapped rather
+// than read; the buffer is writable and ends in the two NUL bytes flex
+// expects after the text.
+class SourceFile {
+public:
+    // reads `path`, or standard input when it is empty
+    static SourceFile open(const std::string &path);
+    // copies program text held in memory
+    static SourceFile from_string(std::string_view text);
+
+    SourceFile(SourceFile &&other);
+    SourceFile(const SourceFile &) = delete;
+    SourceFile& operator=(const SourceFile &) = delete;
+    ~SourceFile();
+
+    char* data() {
+        return mapped ? mapped : buffer.data();
+    }
+
+    // length of the text, without the trailing NUL bytes
+    size_t size() const {
+        return length;
+    }
+
+private:
+    char* mapped = nullptr;
+    size_t mapped_size = 0;
+    std::vector<char> buffer;
+    size_t length = 0;
+
+    SourceFile() {}
+};
+
+// Per-scan state of the lexer, kept out of globals so that several
+// sources may be scanned at once.
+struct ScanState {
+    int line = 1;
+    int column = 1;
+    // copy the scanned text to stdout
+    bool echo = false;
+};
+
+#endif
@@ -3,6 +3,10 @@
 
 #include <string>
 #include <memory>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 class Type {
 public:
@@ -22,7 +26,7 @@ public:
 
     virtual std::string get_type_name() = 0;
 
-    virtual std::shared_ptr<Type> get_element_type() = 0;
+    virtual Type* get_element_type() = 0;
 
     virtual size_t get_size() = 0;
 };
@@ -35,9 +39,7 @@ public:
         return std::string("void");
     }
 
-    virtual std::shared_ptr<Type> get_element_type() override {
-        return std::make_shared<VoidType>();
-    }
+    virtual Type* get_element_type() override;
 
     virtual size_t get_size() {
         return 0;
@@ -54,12 +56,10 @@ public:
         return std::string("i") + std::to_string(bit_width);
     }
 
-    virtual std::shared_ptr<Type> get_element_type() override {
-        return std::make_shared<VoidType>();
-    }
+    virtual Type* get_element_type() override;
 
     virtual size_t get_size() {
-        return bit_width / 8;
+        return static_cast<size_t>(bit_width) / 8;
     };
 };
 
@@ -73,12 +73,10 @@ public:
         return std::string("f") + std::to_string(bit_width);
     }
 
-    virtual std::shared_ptr<Type> get_element_type() override {
-        return std::make_shared<VoidType>();
-    }
+    virtual Type* get_element_type() override;
 
     virtual size_t get_size() {
-        return bit_width / 8;
+        return static_cast<size_t>(bit_width) / 8;
     };
 };
 
@@ -88,16 +86,16 @@ public:
 
 class PointerType : public Type {
 public:
-    std::shared_ptr<Type> element_type;
+    Type* element_type;
 
-    PointerType(std::shared_ptr<Type> n_element_type) :
+    PointerType(Type* n_element_type) :
         Type(TypeID::PointerTyID), element_type(n_element_type) {}
     
     virtual std::string get_type_name() override {
         return element_type->get_type_name() + '*';
     }
 
-    virtual std::shared_ptr<Type> get_element_type() {
+    virtual Type* get_element_type() {
         return element_type;
     }
 
@@ -109,8 +107,8 @@ public:
 class ArrayType : public Type {
 public:
     size_t size;
-    std::shared_ptr<Type> element_type;
-    ArrayType(size_t n_size, std::shared_ptr<Type> n_element_type) :
+    Type* element_type;
+    ArrayType(size_t n_size, Type* n_element_type) :
         Type(TypeID::ArrayTyID), size(n_size), element_type(n_element_type) {}
     
     virtual std::string get_type_name() override {
@@ -118,7 +116,7 @@ public:
             std::to_string(size) + ']';
     }
 
-    virtual std::shared_ptr<Type> get_element_type() {
+    virtual Type* get_element_type() {
         return element_type;
     }
 
@@ -135,13 +133,103 @@ public:
         return std::string("str");
     }
 
-    virtual std::shared_ptr<Type> get_element_type() {
-        return std::make_shared<VoidType>();
-    }
+    virtual Type* get_element_type() override;
 
     virtual size_t get_size() {
         return 8;
     };
 };
 
+// Owns every type of the program. Each distinct type is created once, so
+// types are compared by pointer and stay valid until the program exits.
+// Lookups lock a mutex and may be issued from several threads.
+class TypeContext {
+public:
+    static TypeContext& global() {
+        static TypeContext context;
+        return context;
+    }
+
+    Type* get_void_type() {
+        return void_type;
+    }
+
+    Type* get_string_type() {
+        return string_type;
+    }
+
+    Type* get_integer_type(int bit_width) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &entry = integer_types[bit_width];
+        if (!entry) {
+            entry = own(new IntegerType(bit_width));
+        }
+        return entry;
+    }
+
+    Type* get_float_type(int bit_width) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &entry = float_types[bit_width];
+        if (!entry) {
+            entry = own(new FloatType(bit_width));
+        }
+        return entry;
+    }
+
+    Type* get_pointer_type(Type* element_type) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &entry = pointer_types[element_type];
+        if (!entry) {
+            entry = own(new PointerType(element_type));
+        }
+        return entry;
+    }
+
+    Type* get_array_type(size_t size, Type* element_type) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &entry = array_types[std::make_pair(element_type, size)];
+        if (!entry) {
+            entry = own(new ArrayType(size, element_type));
+        }
+        return entry;
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Type>> types;
+    Type* void_type;
+    Type* string_type;
+    std::map<int, Type*> integer_types;
+    std::map<int, Type*> float_types;
+    // element types are interned already, so their address identifies them
+    std::unordered_map<Type*, Type*> pointer_types;
+    std::map<std::pair<Type*, size_t>, Type*> array_types;
+
+    TypeContext() {
+        void_type = own(new VoidType());
+        string_type = own(new StringType());
+    }
+
+    Type* own(Type* type) {
+        types.emplace_back(type);
+        return type;
+    }
+};
+
+inline Type* VoidType::get_element_type() {
+    return TypeContext::global().get_void_type();
+}
+
+inline Type* IntegerType::get_element_type() {
+    return TypeContext::global().get_void_type();
+}
+
+inline Type* FloatType::get_element_type() {
+    return TypeContext::global().get_void_type();
+}
+
+inline Type* StringType::get_element_type() {
+    return TypeContext::global().get_void_type();
+}
+
 #endif
\ No newline at end of file
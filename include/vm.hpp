@@ -0,0 +1,40 @@
+#ifndef SEMIC_VM_HPP_INCLUDED
+#define SEMIC_VM_HPP_INCLUDED
+
+#include <vector>
+
+#include "bytecode.hpp"
+#include "runtime.hpp"
+
+// Executes a BytecodeModule. Frames are laid out back to back in one slot
+// stack; call and return are handled inside the dispatch loop.
+class VirtualMachine {
+public:
+    VirtualMachine(BytecodeModule &n_module, size_t n_memory_size = 16 << 20);
+
+    void run();
+
+private:
+    struct Frame {
+        const BCFunction* func;
+        const BCInstruction* return_pc;
+        size_t base;
+        size_t memory_mark;
+        int32_t result_slot;
+    };
+
+    BytecodeModule &module;
+    std::vector<BCSlot> stack;
+    std::vector<Frame> frames;
+    StackAllocator memory;
+
+    void execute(bool thread_only);
+
+    BCSlot* push_frame(const BCFunction &func, const BCInstruction* return_pc, int32_t result_slot);
+
+    void print_value(BCSlot value, BCKind kind);
+
+    void print_arguments(const std::vector<BCPrintArgument> &args, const BCSlot* fp);
+};
+
+#endif
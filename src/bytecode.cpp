@@ -0,0 +1,699 @@
+#include <map>
+#include <stdexcept>
+
+#include "bytecode.hpp"
+
+const char* bc_opcode_to_str(BCOpcode op) {
+    static const char* names[] = {
+#define BYTECODE_NAME(name) #name,
+        BYTECODE_OPCODES(BYTECODE_NAME)
+#undef BYTECODE_NAME
+    };
+    return names[static_cast<size_t>(op)];
+}
+
+static BCKind kind_of(Type* type) {
+    if (!type) {
+        return BCKind::none;
+    }
+    switch (type->type_id) {
+    case Type::TypeID::IntegerTyID:
+        return BCKind::integer;
+    case Type::TypeID::FloatTyID:
+        return static_cast<FloatType*>(type)->bit_width == 64 ?
+            BCKind::float64 : BCKind::float32;
+    case Type::TypeID::DoubleTyID:
+        return BCKind::float64;
+    case Type::TypeID::PointerTyID:
+    case Type::TypeID::ArrayTyID:
+        return BCKind::pointer;
+    case Type::TypeID::StringTyID:
+        return BCKind::string;
+    default:
+        return BCKind::none;
+    }
+}
+
+// the kind an instruction computes in, which its operands are converted to
+static BCKind kind_of(IRKind kind) {
+    switch (kind) {
+    case IRKind::i8:
+    case IRKind::i16:
+    case IRKind::i32:
+    case IRKind::i64:
+        return BCKind::integer;
+    case IRKind::f32:
+        return BCKind::float32;
+    case IRKind::f64:
+        return BCKind::float64;
+    case IRKind::ptr:
+        return BCKind::pointer;
+    case IRKind::str:
+        return BCKind::string;
+    default:
+        return BCKind::none;
+    }
+}
+
+static BCOpcode select_binary(IROptype op, BCKind kind) {
+    // rows follow the order of the opcode list: _i, _f, _d
+    int column;
+    switch (kind) {
+    case BCKind::integer: column = 0; break;
+    case BCKind::float32: column = 1; break;
+    case BCKind::float64: column = 2; break;
+    default:
+        throw std::runtime_error("Unsupported operand type");
+    }
+    static const BCOpcode table[][3] = {
+        { BCOpcode::add_i, BCOpcode::add_f, BCOpcode::add_d },
+        { BCOpcode::sub_i, BCOpcode::sub_f, BCOpcode::sub_d },
+        { BCOpcode::mul_i, BCOpcode::mul_f, BCOpcode::mul_d },
+        { BCOpcode::div_i, BCOpcode::div_f, BCOpcode::div_d },
+        { BCOpcode::lt_i, BCOpcode::lt_f, BCOpcode::lt_d },
+        { BCOpcode::gt_i, BCOpcode::gt_f, BCOpcode::gt_d },
+        { BCOpcode::le_i, BCOpcode::le_f, BCOpcode::le_d },
+        { BCOpcode::ge_i, BCOpcode::ge_f, BCOpcode::ge_d },
+        { BCOpcode::and_i, BCOpcode::and_f, BCOpcode::and_d },
+        { BCOpcode::or_i, BCOpcode::or_f, BCOpcode::or_d },
+    };
+    switch (op) {
+    case IROptype::add: return table[0][column];
+    case IROptype::minus: return table[1][column];
+    case IROptype::mul: return table[2][column];
+    case IROptype::divide: return table[3][column];
+    case IROptype::less: return table[4][column];
+    case IROptype::greater: return table[5][column];
+    case IROptype::less_equal: return table[6][column];
+    case IROptype::greater_equal: return table[7][column];
+    case IROptype::land: return table[8][column];
+    case IROptype::lor: return table[9][column];
+    default:
+        throw std::runtime_error("Unsupported binary operator");
+    }
+}
+
+// integer arithmetic on i32 operands wraps around at 32 bits
+static BCOpcode wrap_32(BCOpcode op) {
+    switch (op) {
+    case BCOpcode::add_i: return BCOpcode::add_w;
+    case BCOpcode::sub_i: return BCOpcode::sub_w;
+    case BCOpcode::mul_i: return BCOpcode::mul_w;
+    case BCOpcode::div_i: return BCOpcode::div_w;
+    case BCOpcode::inc_i: return BCOpcode::inc_w;
+    case BCOpcode::dec_i: return BCOpcode::dec_w;
+    default: return op;
+    }
+}
+
+// integer to narrower integer casts; mov when no sign extension is needed
+static BCOpcode select_narrowing(IRKind from, IRKind to) {
+    auto width = [](IRKind kind) {
+        switch (kind) {
+        case IRKind::i8: return 8;
+        case IRKind::i16: return 16;
+        case IRKind::i32: return 32;
+        case IRKind::i64: return 64;
+        default: return 0;
+        }
+    };
+    if (width(from) == 0 || width(to) == 0 || width(to) >= width(from)) {
+        return BCOpcode::mov;
+    }
+    switch (to) {
+    case IRKind::i8: return BCOpcode::sext_8;
+    case IRKind::i16: return BCOpcode::sext_16;
+    default: return BCOpcode::sext_32;
+    }
+}
+
+static BCOpcode select_memory(bool is_load, Type* element_type) {
+    switch (kind_of(element_type)) {
+    case BCKind::integer:
+        switch (element_type->get_size()) {
+        case 1: return is_load ? BCOpcode::load_i8 : BCOpcode::store_i8;
+        case 2: return is_load ? BCOpcode::load_i16 : BCOpcode::store_i16;
+        case 4: return is_load ? BCOpcode::load_i32 : BCOpcode::store_i32;
+        case 8: return is_load ? BCOpcode::load_i64 : BCOpcode::store_i64;
+        default: break;
+        }
+        break;
+    case BCKind::float32:
+        return is_load ? BCOpcode::load_f : BCOpcode::store_f;
+    case BCKind::float64:
+        return is_load ? BCOpcode::load_d : BCOpcode::store_d;
+    case BCKind::pointer:
+        return is_load ? BCOpcode::load_i64 : BCOpcode::store_i64;
+    default:
+        break;
+    }
+    throw std::runtime_error("Unsupported type");
+}
+
+// Lowers one IRFunction. Variables and temps keep the slots assigned at
+// codegen time; conversions get scratch slots behind them. A literal is
+// referenced as `-1 - constant index` until the frame size is known and then
+// relocated behind all other slots.
+class FunctionLowering {
+public:
+    FunctionLowering(
+        BytecodeModule &n_module,
+        std::map<const IRFunction*, int32_t> &n_func_index,
+        CodeGenContext &n_context,
+        IRFunction &n_func,
+        BCFunction &n_out
+    ) : module(n_module), func_index(n_func_index), context(n_context),
+        func(n_func), out(n_out) {}
+
+    void lower() {
+        out.name = SymbolTable::global().get(func.func_name);
+        out.return_kind = kind_of(func.return_type);
+
+        slot_kinds.assign(static_cast<size_t>(func.slot_count), BCKind::none);
+        for (int32_t slot = 0; slot < func.slot_count; slot++) {
+            slot_map.push_back(slot);
+        }
+
+        // parameters occupy the first slots so a call can copy arguments
+        for (size_t i = 0; i < func.arg_vec.size(); i++) {
+            auto &arg = func.arg_vec[i];
+            if (arg.get_slot() != static_cast<int>(i)) {
+                throw std::runtime_error("Parameter slots of " + SymbolTable::global().get(func.func_name) + " are not contiguous");
+            }
+            define(arg.get_slot(), kind_of(arg.value_type));
+        }
+        out.param_count = static_cast<int32_t>(func.arg_vec.size());
+
+        for (auto &decl : func.decl_vec) {
+            int32_t slot = define(decl.get_slot(), kind_of(decl.value_type));
+            if (decl.value_type->type_id == Type::TypeID::ArrayTyID) {
+                out.arrays.push_back(BCArray { slot, decl.value_type->get_size() });
+            }
+        }
+
+        // copies left by destruct_ssa are the only writes of a phi slot,
+        // and may be lowered after its readers
+        for (auto block : func.body) {
+            for (auto statement : block->statements) {
+                if (statement->type != IROptype::assign) {
+                    continue;
+                }
+                auto &lhs = static_cast<IRBinary*>(statement)->lhs;
+                if (lhs.type == IROpearndType::temp) {
+                    define(lhs.get_slot(), kind_of(lhs.value_type));
+                }
+            }
+        }
+
+        std::vector<int32_t> block_pc(func.body.size());
+        for (size_t bid = 0; bid < func.body.size(); bid++) {
+            auto block = func.body[bid];
+            block_pc[static_cast<size_t>(block->bid)] = static_cast<int32_t>(out.code.size());
+            for (auto statement : block->statements) {
+                lower_statement(statement);
+            }
+            lower_jump(block->jump, bid + 1 == func.body.size() ? -1 : static_cast<int>(bid + 1));
+        }
+
+        for (auto &fixup : jump_fixups) {
+            out.code[fixup.first].a = block_pc.at(static_cast<size_t>(fixup.second));
+        }
+        for (auto &table : out.switch_tables) {
+            for (auto &target : table.targets) {
+                target = block_pc.at(static_cast<size_t>(target));
+            }
+            table.default_target = block_pc.at(static_cast<size_t>(table.default_target));
+        }
+
+        relocate_constants();
+    }
+
+private:
+    BytecodeModule &module;
+    std::map<const IRFunction*, int32_t> &func_index;
+    CodeGenContext &context;
+    IRFunction &func;
+    BCFunction &out;
+
+    // codegen slot -> frame slot, differs only where a result is aliased
+    std::vector<int32_t> slot_map;
+    std::vector<BCKind> slot_kinds;
+    std::vector<std::pair<size_t, int>> jump_fixups;
+
+    int32_t define(int slot, BCKind kind) {
+        if (slot < 0) {
+            return new_slot(kind);
+        }
+        slot_kinds[static_cast<size_t>(slot)] = kind;
+        return slot;
+    }
+
+    void alias(int slot, int32_t target) {
+        if (slot >= 0) {
+            slot_map[static_cast<size_t>(slot)] = target;
+        }
+    }
+
+    int32_t new_slot(BCKind kind) {
+        slot_kinds.push_back(kind);
+        return static_cast<int32_t>(slot_kinds.size() - 1);
+    }
+
+    BCKind kind_of_slot(int32_t slot) {
+        if (slot < 0) {
+            return out.constant_kinds[static_cast<size_t>(-1 - slot)];
+        }
+        return slot_kinds[static_cast<size_t>(slot)];
+    }
+
+    int32_t constant(BCSlot value, BCKind kind) {
+        for (size_t i = 0; i < out.constants.size(); i++) {
+            if (out.constant_kinds[i] == kind && out.constants[i].i == value.i) {
+                return -1 - static_cast<int32_t>(i);
+            }
+        }
+        out.constants.push_back(value);
+        out.constant_kinds.push_back(kind);
+        return -static_cast<int32_t>(out.constants.size());
+    }
+
+    int32_t constant(const IRLiteral &literal) {
+        BCSlot slot;
+        slot.i = 0;
+        if (auto int_value = std::get_if<uint64_t>(&literal.value)) {
+            slot.i = *int_value;
+            return constant(slot, BCKind::integer);
+        }
+        if (auto double_value = std::get_if<double>(&literal.value)) {
+            if (kind_of(literal.value_type) == BCKind::float32) {
+                slot.f = static_cast<float>(*double_value);
+                return constant(slot, BCKind::float32);
+            }
+            slot.d = *double_value;
+            return constant(slot, BCKind::float64);
+        }
+        module.strings.push_back(std::get<std::string>(literal.value));
+        slot.s = &module.strings.back();
+        return constant(slot, BCKind::string);
+    }
+
+    int32_t operand(const IRValue &value) {
+        switch (value.type) {
+        case IROpearndType::id:
+        case IROpearndType::temp: {
+            int slot = value.get_slot();
+            if (slot < 0) {
+                throw std::runtime_error("Unknown operand " + value.get_name());
+            }
+            return slot_map[static_cast<size_t>(slot)];
+        }
+        case IROpearndType::constant:
+            return constant(func.constants[value.get_constant_index()]);
+        default:
+            throw std::runtime_error("Unsupported operand");
+        }
+    }
+
+    void emit(BCOpcode op, int32_t a, int32_t b = 0, int32_t c = 0) {
+        out.code.push_back(BCInstruction { nullptr, op, a, b, c });
+    }
+
+    // literals are converted while lowering, other slots through a cvt
+    int32_t convert(int32_t slot, BCKind to) {
+        BCKind from = kind_of_slot(slot);
+        if (from == to) {
+            return slot;
+        }
+        bool from_int = from == BCKind::integer, to_int = to == BCKind::integer;
+        if (slot < 0) {
+            BCSlot value = out.constants[static_cast<size_t>(-1 - slot)], result;
+            result.i = 0;
+            if (from_int && to == BCKind::float32) {
+                result.f = static_cast<float>(value.i);
+            } else if (from_int && to == BCKind::float64) {
+                result.d = static_cast<double>(value.i);
+            } else if (from == BCKind::float32 && to_int) {
+                result.i = static_cast<uint64_t>(value.f);
+            } else if (from == BCKind::float64 && to_int) {
+                result.i = static_cast<uint64_t>(value.d);
+            } else if (from == BCKind::float32 && to == BCKind::float64) {
+                result.d = static_cast<double>(value.f);
+            } else if (from == BCKind::float64 && to == BCKind::float32) {
+                result.f = static_cast<float>(value.d);
+            } else {
+                return slot;
+            }
+            return constant(result, to);
+        }
+
+        BCOpcode op;
+        if (from_int && to == BCKind::float32) {
+            op = BCOpcode::cvt_i_f;
+        } else if (from_int && to == BCKind::float64) {
+            op = BCOpcode::cvt_i_d;
+        } else if (from == BCKind::float32 && to_int) {
+            op = BCOpcode::cvt_f_i;
+        } else if (from == BCKind::float64 && to_int) {
+            op = BCOpcode::cvt_d_i;
+        } else if (from == BCKind::float32 && to == BCKind::float64) {
+            op = BCOpcode::cvt_f_d;
+        } else if (from == BCKind::float64 && to == BCKind::float32) {
+            op = BCOpcode::cvt_d_f;
+        } else {
+            // integers and pointers share a representation
+            return slot;
+        }
+        int32_t result = new_slot(to);
+        emit(op, result, slot);
+        return result;
+    }
+
+    BCPrintArgument print_argument(const IRValue &value, int32_t slot) {
+        BCPrintArgument arg { slot, kind_of_slot(slot), 0, 0, BCKind::none };
+        if (value.value_type && value.value_type->type_id == Type::TypeID::ArrayTyID) {
+            auto element_type = value.value_type->get_element_type();
+            arg.element_size = element_type->get_size();
+            arg.element_kind = kind_of(element_type);
+            arg.array_length = value.value_type->get_size() / arg.element_size;
+        }
+        return arg;
+    }
+
+    void lower_statement(IR* ir) {
+        switch (ir->type) {
+        case IROptype::add:
+        case IROptype::minus:
+        case IROptype::mul:
+        case IROptype::divide:
+        case IROptype::less:
+        case IROptype::greater:
+        case IROptype::less_equal:
+        case IROptype::greater_equal:
+        case IROptype::land:
+        case IROptype::lor: {
+            auto binary = static_cast<IRBinary*>(ir);
+            BCKind kind = kind_of(binary->kind);
+            int32_t lhs = convert(operand(binary->lhs), kind);
+            int32_t rhs = convert(operand(binary->rhs), kind);
+            bool arithmetic = ir->type == IROptype::add || ir->type == IROptype::minus ||
+                ir->type == IROptype::mul || ir->type == IROptype::divide;
+            int32_t result = define(ir->result_slot, arithmetic ? kind : BCKind::integer);
+            BCOpcode op = select_binary(ir->type, kind);
+            if (binary->kind == IRKind::i32) {
+                op = wrap_32(op);
+            }
+            emit(op, result, lhs, rhs);
+            break;
+        }
+        case IROptype::assign: {
+            auto binary = static_cast<IRBinary*>(ir);
+            int32_t lhs = operand(binary->lhs);
+            int32_t rhs = convert(operand(binary->rhs), kind_of(binary->kind));
+            emit(BCOpcode::mov, lhs, rhs);
+            // the value of an assignment expression is its left hand side
+            alias(ir->result_slot, lhs);
+            break;
+        }
+        case IROptype::inc:
+        case IROptype::dec: {
+            auto unary = static_cast<IRUnary*>(ir);
+            int32_t lhs = operand(unary->lhs);
+            BCKind kind = kind_of(unary->kind);
+            BCOpcode op;
+            switch (kind) {
+            case BCKind::integer: op = ir->type == IROptype::inc ? BCOpcode::inc_i : BCOpcode::dec_i; break;
+            case BCKind::float32: op = ir->type == IROptype::inc ? BCOpcode::inc_f : BCOpcode::dec_f; break;
+            case BCKind::float64: op = ir->type == IROptype::inc ? BCOpcode::inc_d : BCOpcode::dec_d; break;
+            default:
+                throw std::runtime_error("Unsupported operand type");
+            }
+            if (unary->kind == IRKind::i32) {
+                op = wrap_32(op);
+            }
+            emit(op, define(ir->result_slot, kind), lhs);
+            break;
+        }
+        case IROptype::typecast: {
+            auto cast = static_cast<IRCast*>(ir);
+            int32_t value = operand(cast->value);
+            BCKind kind = kind_of(cast->target_type);
+            int32_t result = convert(value, kind);
+            BCOpcode narrow = select_narrowing(ir_kind_of(cast->value.value_type), ir_kind_of(cast->target_type));
+            if (narrow != BCOpcode::mov) {
+                result = define(ir->result_slot, kind);
+                emit(narrow, result, value);
+            } else if (result == value && value >= 0) {
+                result = define(ir->result_slot, kind);
+                emit(BCOpcode::mov, result, value);
+            }
+            alias(ir->result_slot, result);
+            break;
+        }
+        case IROptype::array_index: {
+            auto array_index = static_cast<IRArrayIndex*>(ir);
+            int32_t array = operand(array_index->array);
+            int32_t index_slot = convert(operand(array_index->index), BCKind::integer);
+            BCOpcode op;
+            switch (array_index->array.value_type->get_element_type()->get_size()) {
+            case 1: op = BCOpcode::index_1; break;
+            case 2: op = BCOpcode::index_2; break;
+            case 4: op = BCOpcode::index_4; break;
+            case 8: op = BCOpcode::index_8; break;
+            default:
+                throw std::runtime_error("Unsupported element size");
+            }
+            emit(op, define(ir->result_slot, BCKind::pointer), array, index_slot);
+            break;
+        }
+        case IROptype::load: {
+            auto load = static_cast<IRLoad*>(ir);
+            int32_t pointer = operand(load->pointer);
+            auto element_type = load->pointer.value_type->get_element_type();
+            emit(select_memory(true, element_type), define(ir->result_slot, kind_of(element_type)), pointer);
+            break;
+        }
+        case IROptype::store: {
+            auto store = static_cast<IRStore*>(ir);
+            int32_t pointer = operand(store->pointer);
+            auto element_type = store->pointer.value_type->get_element_type();
+            int32_t value = convert(operand(store->value), kind_of(element_type));
+            emit(select_memory(false, element_type), pointer, value);
+            break;
+        }
+        case IROptype::call: {
+            auto call = static_cast<IRMethodCall*>(ir);
+            auto callee = call->callee;
+            auto callee_it = func_index.find(callee);
+            if (callee_it == func_index.end()) {
+                throw std::runtime_error("Unknown function " + SymbolTable::global().get(call->name));
+            }
+            BCCallSite site;
+            site.callee = callee_it->second;
+            for (size_t i = 0; i < call->arguments.size(); i++) {
+                int32_t arg = operand(call->arguments[i]);
+                site.print_args.push_back(print_argument(call->arguments[i], arg));
+                if (i < callee->arg_vec.size()) {
+                    arg = convert(arg, kind_of(callee->arg_vec[i].value_type));
+                }
+                site.arg_slots.push_back(arg);
+            }
+            BCKind return_kind = kind_of(callee->return_type);
+            site.result_slot = return_kind == BCKind::none ? -1 : define(ir->result_slot, return_kind);
+            out.call_sites.push_back(site);
+            emit(BCOpcode::call, static_cast<int32_t>(out.call_sites.size() - 1));
+            break;
+        }
+        case IROptype::printf_func: {
+            auto call = static_cast<IRPrintf*>(ir);
+            BCPrintSite site;
+            for (auto &arg : call->arguments) {
+                site.print_args.push_back(print_argument(arg, operand(arg)));
+            }
+            out.print_sites.push_back(site);
+            emit(BCOpcode::printf, static_cast<int32_t>(out.print_sites.size() - 1));
+            break;
+        }
+        default:
+            throw std::runtime_error("Unsupported IR " + ir_optype_to_str(ir->type));
+        }
+    }
+
+    void lower_jump(IRJump &jump, int next_bid) {
+        switch (jump.jump_type) {
+        case IRJump::IRJumpType::direct: {
+            auto direct_jump = std::get<IRJump::DirectJump>(jump.jump);
+            if (direct_jump.jump_bid != next_bid) {
+                emit_jump(BCOpcode::jmp, direct_jump.jump_bid, 0);
+            }
+            break;
+        }
+        case IRJump::IRJumpType::cond: {
+            auto cond_jump = std::get<IRJump::CondJump>(jump.jump);
+            // a float is tested as it is, truncating it would turn 0.5 false
+            int32_t cond = operand(cond_jump.cond_value);
+            BCOpcode br_true = BCOpcode::br_true, br_false = BCOpcode::br_false;
+            switch (kind_of_slot(cond)) {
+            case BCKind::float32:
+                br_true = BCOpcode::br_true_f;
+                br_false = BCOpcode::br_false_f;
+                break;
+            case BCKind::float64:
+                br_true = BCOpcode::br_true_d;
+                br_false = BCOpcode::br_false_d;
+                break;
+            default:
+                cond = convert(cond, BCKind::integer);
+                break;
+            }
+            if (cond_jump.true_bid == next_bid) {
+                emit_jump(br_false, cond_jump.false_bid, cond);
+            } else {
+                emit_jump(br_true, cond_jump.true_bid, cond);
+                if (cond_jump.false_bid != next_bid) {
+                    emit_jump(BCOpcode::jmp, cond_jump.false_bid, 0);
+                }
+            }
+            break;
+        }
+        case IRJump::IRJumpType::multiway: {
+            auto &switch_jump = std::get<IRJump::SwitchJump>(jump.jump);
+            int32_t value = convert(operand(switch_jump.value), BCKind::integer);
+            BCSwitchTable table;
+            table.default_target = switch_jump.default_bid;
+            auto &cases = switch_jump.cases;
+            // a table indexed by value when at least half of it is cases,
+            // a binary search otherwise
+            uint64_t span = cases.empty() ? 0 :
+                static_cast<uint64_t>(cases.back().first) - static_cast<uint64_t>(cases.front().first) + 1;
+            bool dense = !cases.empty() && span <= 2 * cases.size();
+            if (dense) {
+                table.low = cases.front().first;
+                table.targets.assign(span, switch_jump.default_bid);
+                for (auto &item : cases) {
+                    table.targets[static_cast<size_t>(item.first - table.low)] = item.second;
+                }
+            } else {
+                for (auto &item : cases) {
+                    table.keys.push_back(item.first);
+                    table.targets.push_back(item.second);
+                }
+            }
+            out.switch_tables.push_back(std::move(table));
+            emit(dense ? BCOpcode::switch_table : BCOpcode::switch_search,
+                static_cast<int32_t>(out.switch_tables.size() - 1), value);
+            break;
+        }
+        case IRJump::IRJumpType::ret: {
+            auto ret_jump = std::get<IRJump::RetJump>(jump.jump);
+            int32_t value = convert(operand(ret_jump.return_value), out.return_kind);
+            emit(BCOpcode::ret, value);
+            break;
+        }
+        default:
+            // falling off the end of a function returns without a value
+            emit(BCOpcode::ret_void, 0);
+            break;
+        }
+    }
+
+    void emit_jump(BCOpcode op, int target_bid, int32_t cond) {
+        jump_fixups.push_back(std::make_pair(out.code.size(), target_bid));
+        emit(op, 0, cond);
+    }
+
+    void relocate_constants() {
+        out.constant_base = static_cast<int32_t>(slot_kinds.size());
+        out.frame_size = out.constant_base + static_cast<int32_t>(out.constants.size());
+        auto relocate = [this](int32_t &slot) {
+            if (slot < 0) {
+                slot = out.constant_base - 1 - slot;
+            }
+        };
+        for (auto &ins : out.code) {
+            switch (ins.op) {
+            case BCOpcode::jmp:
+            case BCOpcode::call:
+            case BCOpcode::printf:
+            case BCOpcode::ret_void:
+                break;
+            case BCOpcode::br_true:
+            case BCOpcode::br_false:
+            case BCOpcode::br_true_f:
+            case BCOpcode::br_false_f:
+            case BCOpcode::br_true_d:
+            case BCOpcode::br_false_d:
+            case BCOpcode::switch_table:
+            case BCOpcode::switch_search:
+                relocate(ins.b);
+                break;
+            default:
+                relocate(ins.a);
+                relocate(ins.b);
+                relocate(ins.c);
+                break;
+            }
+        }
+        for (auto &site : out.call_sites) {
+            for (auto &slot : site.arg_slots) {
+                relocate(slot);
+            }
+            for (auto &arg : site.print_args) {
+                relocate(arg.slot);
+            }
+        }
+        for (auto &site : out.print_sites) {
+            for (auto &arg : site.print_args) {
+                relocate(arg.slot);
+            }
+        }
+    }
+};
+
+BytecodeModule lower_to_bytecode(CodeGenContext &context) {
+    BytecodeModule module;
+    std::map<const IRFunction*, int32_t> func_index;
+    for (auto it = context.func_defs.begin(); it != context.func_defs.end(); it++) {
+        int32_t index = static_cast<int32_t>(func_index.size());
+        func_index[it->second.get()] = index;
+    }
+    module.functions.resize(func_index.size());
+    for (auto it = context.func_defs.begin(); it != context.func_defs.end(); it++) {
+        auto &out = module.functions[static_cast<size_t>(func_index[it->second.get()])];
+        FunctionLowering(module, func_index, context, *it->second, out).lower();
+    }
+
+    auto main_func = context.find_func_by_name(SymbolTable::global().intern("main"));
+    if (!main_func) {
+        throw std::runtime_error("No main function");
+    }
+    module.entry = func_index[main_func.get()];
+    return module;
+}
+
+void BCFunction::print() {
+    std::cout << name << '(' << param_count << ") frame " << frame_size << '\n';
+    for (size_t i = 0; i < constants.size(); i++) {
+        std::cout << "\tconst " << constant_base + static_cast<int32_t>(i) << " = ";
+        switch (constant_kinds[i]) {
+        case BCKind::float32: std::cout << constants[i].f; break;
+        case BCKind::float64: std::cout << constants[i].d; break;
+        case BCKind::string: std::cout << *constants[i].s; break;
+        default: std::cout << constants[i].i; break;
+        }
+        std::cout << '\n';
+    }
+    for (size_t pc = 0; pc < code.size(); pc++) {
+        auto &ins = code[pc];
+        std::cout << '\t' << pc << ": " << bc_opcode_to_str(ins.op) << ' '
+            << ins.a << ' ' << ins.b << ' ' << ins.c << '\n';
+    }
+    for (size_t i = 0; i < switch_tables.size(); i++) {
+        auto &table = switch_tables[i];
+        std::cout << "\tswitch " << i << ':';
+        for (size_t j = 0; j < table.targets.size(); j++) {
+            std::cout << ' ' << (table.keys.empty() ? table.low + static_cast<int64_t>(j) : table.keys[j])
+                << "->" << table.targets[j];
+        }
+        std::cout << " default->" << table.default_target << '\n';
+    }
+}
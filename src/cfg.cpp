@@ -0,0 +1,199 @@
+#include <algorithm>
+
+#include "cfg.hpp"
+
+ControlFlowGraph::ControlFlowGraph(IRFunction &func) {
+    size_t count = func.body.size();
+    succs.resize(count);
+    preds.resize(count);
+    idom.assign(count, -1);
+    dom_children.resize(count);
+    rpo_index.assign(count, -1);
+    dom_enter.assign(count, -1);
+    dom_exit.assign(count, -1);
+
+    for (size_t bid = 0; bid < count; bid++) {
+        for (int target : func.body[bid]->jump.targets()) {
+            auto &out = succs[bid];
+            if (std::find(out.begin(), out.end(), target) == out.end()) {
+                out.push_back(target);
+            }
+        }
+    }
+
+    // postorder by an explicit stack, bodies may nest deeper than the
+    // native one allows; successors are taken last to first so that the
+    // first one follows its block in reverse postorder
+    std::vector<bool> visited(count);
+    std::vector<std::pair<int, size_t>> stack { { 0, 0 } };
+    visited[0] = true;
+    while (!stack.empty()) {
+        auto &top = stack.back();
+        auto &out = succs[static_cast<size_t>(top.first)];
+        if (top.second < out.size()) {
+            int next = out[out.size() - 1 - top.second++];
+            if (!visited[static_cast<size_t>(next)]) {
+                visited[static_cast<size_t>(next)] = true;
+                stack.push_back({ next, 0 });
+            }
+        } else {
+            order.push_back(top.first);
+            stack.pop_back();
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    for (size_t i = 0; i < order.size(); i++) {
+        rpo_index[static_cast<size_t>(order[i])] = static_cast<int>(i);
+    }
+
+    for (int bid : order) {
+        for (int succ : succs[static_cast<size_t>(bid)]) {
+            preds[static_cast<size_t>(succ)].push_back(bid);
+        }
+    }
+
+    // Cooper, Harvey and Kennedy, "A Simple, Fast Dominance Algorithm"
+    auto intersect = [&](int lhs, int rhs) {
+        while (lhs != rhs) {
+            while (rpo_index[static_cast<size_t>(lhs)] > rpo_index[static_cast<size_t>(rhs)]) {
+                lhs = idom[static_cast<size_t>(lhs)];
+            }
+            while (rpo_index[static_cast<size_t>(rhs)] > rpo_index[static_cast<size_t>(lhs)]) {
+                rhs = idom[static_cast<size_t>(rhs)];
+            }
+        }
+        return lhs;
+    };
+    idom[0] = 0;
+    for (bool changed = true; changed; ) {
+        changed = false;
+        for (size_t i = 1; i < order.size(); i++) {
+            size_t bid = static_cast<size_t>(order[i]);
+            int new_idom = -1;
+            for (int pred : preds[bid]) {
+                if (idom[static_cast<size_t>(pred)] < 0) {
+                    continue;
+                }
+                new_idom = new_idom < 0 ? pred : intersect(pred, new_idom);
+            }
+            if (idom[bid] != new_idom) {
+                idom[bid] = new_idom;
+                changed = true;
+            }
+        }
+    }
+    idom[0] = -1;
+
+    for (size_t i = 1; i < order.size(); i++) {
+        dom_children[static_cast<size_t>(idom[static_cast<size_t>(order[i])])].push_back(order[i]);
+    }
+
+    int clock = 0;
+    std::vector<std::pair<int, size_t>> walk { { 0, 0 } };
+    dom_enter[0] = clock++;
+    while (!walk.empty()) {
+        auto &top = walk.back();
+        auto &children = dom_children[static_cast<size_t>(top.first)];
+        if (top.second < children.size()) {
+            int child = children[top.second++];
+            dom_enter[static_cast<size_t>(child)] = clock++;
+            walk.push_back({ child, 0 });
+        } else {
+            dom_exit[static_cast<size_t>(top.first)] = clock++;
+            walk.pop_back();
+        }
+    }
+}
+
+std::vector<std::vector<int>> ControlFlowGraph::dominance_frontiers() const {
+    std::vector<std::vector<int>> frontiers(succs.size());
+    for (int bid : order) {
+        auto &bid_preds = preds[static_cast<size_t>(bid)];
+        if (bid_preds.size() < 2) {
+            continue;
+        }
+        int bid_idom = idom[static_cast<size_t>(bid)];
+        for (int pred : bid_preds) {
+            for (int runner = pred; runner != bid_idom; runner = idom[static_cast<size_t>(runner)]) {
+                auto &frontier = frontiers[static_cast<size_t>(runner)];
+                if (frontier.empty() || frontier.back() != bid) {
+                    frontier.push_back(bid);
+                }
+            }
+        }
+    }
+    return frontiers;
+}
+
+bool Loop::contains(int bid) const {
+    return std::binary_search(blocks.begin(), blocks.end(), bid);
+}
+
+std::vector<Loop> find_loops(const ControlFlowGraph &cfg) {
+    std::vector<Loop> loops;
+    std::vector<int> seen(cfg.succs.size(), -1);
+    for (int header : cfg.order) {
+        std::vector<int> worklist;
+        for (int pred : cfg.preds[static_cast<size_t>(header)]) {
+            if (cfg.dominates(header, pred)) {
+                worklist.push_back(pred);
+            }
+        }
+        if (worklist.empty()) {
+            continue;
+        }
+
+        Loop loop;
+        loop.header = header;
+        seen[static_cast<size_t>(header)] = header;
+        loop.blocks.push_back(header);
+        while (!worklist.empty()) {
+            int bid = worklist.back();
+            worklist.pop_back();
+            auto &mark = seen[static_cast<size_t>(bid)];
+            if (mark == header) {
+                continue;
+            }
+            mark = header;
+            loop.blocks.push_back(bid);
+            for (int pred : cfg.preds[static_cast<size_t>(bid)]) {
+                worklist.push_back(pred);
+            }
+        }
+        std::sort(loop.blocks.begin(), loop.blocks.end());
+
+        int outside = -1;
+        for (int pred : cfg.preds[static_cast<size_t>(header)]) {
+            if (loop.contains(pred)) {
+                continue;
+            }
+            outside = outside == -1 ? pred : -2;
+        }
+        if (outside >= 0 && cfg.succs[static_cast<size_t>(outside)].size() == 1) {
+            loop.preheader = outside;
+        }
+        loops.push_back(std::move(loop));
+    }
+    std::stable_sort(loops.begin(), loops.end(), [](const Loop &lhs, const Loop &rhs) {
+        return lhs.blocks.size() < rhs.blocks.size();
+    });
+    return loops;
+}
+
+std::vector<bool> find_written_slots(IRFunction &func) {
+    std::vector<bool> written(static_cast<size_t>(func.slot_count));
+    for (auto block : func.body) {
+        for (auto ir : block->statements) {
+            int slot = -1;
+            if (ir->type == IROptype::assign) {
+                slot = static_cast<IRBinary*>(ir)->lhs.get_slot();
+            } else if (ir->type == IROptype::inc || ir->type == IROptype::dec) {
+                slot = static_cast<IRUnary*>(ir)->lhs.get_slot();
+            }
+            if (slot >= 0) {
+                written[static_cast<size_t>(slot)] = true;
+            }
+        }
+    }
+    return written;
+}
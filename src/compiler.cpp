@@ -0,0 +1,86 @@
+#include <atomic>
+#include <exception>
+#include <vector>
+
+#include "compiler.hpp"
+#include "node.hpp"
+#include "pass.hpp"
+
+// defined with the scanner in semic.l
+void parse_source(SourceFile &source, TranslationUnit &unit, bool echo);
+
+// bodies are cheap to generate, a thread is only worth starting for a
+// batch of functions
+static const size_t functions_per_job = 16;
+
+// the engines run no phis, so SSA is taken apart again before they start
+static void optimize_function(IRFunction &func) {
+    construct_ssa(func);
+    propagate_constants(func);
+    number_values(func);
+    hoist_loop_invariants(func);
+    eliminate_dead_code(func);
+    destruct_ssa(func);
+    simplify_cfg(func);
+}
+
+std::unique_ptr<CodeGenContext> Compiler::compile(SourceFile &source) {
+    TranslationUnit unit;
+    parse_source(source, unit, echo);
+    auto context = std::make_unique<CodeGenContext>();
+
+    // signatures first, so that any body may call any function
+    std::vector<std::shared_ptr<IRFunction>> functions;
+    for (auto func_decl : unit.functions) {
+        functions.push_back(func_decl->declare(*context));
+    }
+
+    // then the bodies, and once all exist and any callees have been inlined,
+    // the passes over each
+    for_each_function(functions.size(), [&](size_t i) {
+        FunctionBuilder builder(*context, functions[i]);
+        unit.functions[i]->codeGen(builder);
+    });
+    if (optimize) {
+        if (inline_calls) {
+            inline_functions(*context);
+        }
+        for_each_function(functions.size(), [&](size_t i) {
+            optimize_function(*functions[i]);
+        });
+    }
+    return context;
+}
+
+// Runs task(i) for every function, each on whichever worker takes it
+// next; the first error in source order is the one reported.
+void Compiler::for_each_function(size_t count, const std::function<void(size_t)> &task) {
+    std::vector<std::exception_ptr> errors(count);
+    std::atomic<size_t> next { 0 };
+    auto work = [&]() {
+        for (size_t i = next++; i < count; i = next++) {
+            try {
+                task(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+    size_t workers = std::min<size_t>(jobs, count / functions_per_job);
+    if (workers <= 1) {
+        work();
+    } else {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < workers; i++) {
+            threads.emplace_back(work);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    for (auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
@@ -0,0 +1,192 @@
+#include <algorithm>
+
+#include "cfg.hpp"
+#include "pass.hpp"
+
+void eliminate_dead_code(IRFunction &func) {
+    // instructions without side effects, by the slot they define
+    size_t slot_count = static_cast<size_t>(func.slot_count);
+    std::vector<IR*> def_of_slot(slot_count);
+    for (auto block : func.body) {
+        for (auto ir : block->statements) {
+            if (ir->result_slot >= 0 && !has_side_effects(ir->type)) {
+                def_of_slot[static_cast<size_t>(ir->result_slot)] = ir;
+            }
+        }
+    }
+
+    // everything with an effect is live, and so is whatever it reads
+    std::vector<bool> live(slot_count);
+    std::vector<size_t> worklist;
+    auto mark = [&](IRValue &value) {
+        if (value.type != IROpearndType::temp) {
+            return;
+        }
+        size_t slot = static_cast<size_t>(value.get_slot());
+        if (!live[slot]) {
+            live[slot] = true;
+            worklist.push_back(slot);
+        }
+    };
+    for (auto block : func.body) {
+        for (auto ir : block->statements) {
+            if (has_side_effects(ir->type)) {
+                ir->visit_operands(mark);
+            }
+        }
+        if (auto value = block->jump.operand()) {
+            mark(*value);
+        }
+    }
+    while (!worklist.empty()) {
+        auto def = def_of_slot[worklist.back()];
+        worklist.pop_back();
+        if (def) {
+            def->visit_operands(mark);
+        }
+    }
+
+    for (auto block : func.body) {
+        auto &statements = block->statements;
+        statements.erase(std::remove_if(statements.begin(), statements.end(), [&](IR* ir) {
+            return !has_side_effects(ir->type) && (ir->result_slot < 0 || !live[static_cast<size_t>(ir->result_slot)]);
+        }), statements.end());
+    }
+}
+
+// Lays the blocks that can be reached out in reverse postorder, so that
+// a block comes after its dominators, and drops the others along with the
+// phi inputs coming from them.
+static bool renumber_blocks(IRFunction &func) {
+    ControlFlowGraph cfg(func);
+    bool in_order = cfg.order.size() == func.body.size();
+    for (size_t i = 0; in_order && i < cfg.order.size(); i++) {
+        in_order = cfg.order[i] == static_cast<int>(i);
+    }
+    if (in_order) {
+        return false;
+    }
+    std::vector<int> new_bids(func.body.size(), -1);
+    std::vector<IRBlock*> body;
+    for (int bid : cfg.order) {
+        new_bids[static_cast<size_t>(bid)] = static_cast<int>(body.size());
+        body.push_back(func.body[static_cast<size_t>(bid)]);
+    }
+    for (auto block : body) {
+        block->bid = new_bids[static_cast<size_t>(block->bid)];
+        block->jump.visit_targets([&](int &target) {
+            target = new_bids[static_cast<size_t>(target)];
+        });
+        for (auto ir : block->statements) {
+            if (ir->type != IROptype::phi) {
+                continue;
+            }
+            auto &incoming = static_cast<IRPhi*>(ir)->incoming;
+            incoming.erase(std::remove_if(incoming.begin(), incoming.end(), [&](const std::pair<int, IRValue> &edge) {
+                return new_bids[static_cast<size_t>(edge.first)] < 0;
+            }), incoming.end());
+            for (auto &edge : incoming) {
+                edge.first = new_bids[static_cast<size_t>(edge.first)];
+            }
+        }
+    }
+    func.body = std::move(body);
+    return true;
+}
+
+static bool has_phis(IRBlock* block) {
+    return !block->statements.empty() && block->statements.front()->type == IROptype::phi;
+}
+
+static void rename_predecessor(IRBlock* block, int old_bid, int new_bid) {
+    for (auto ir : block->statements) {
+        if (ir->type != IROptype::phi) {
+            break;
+        }
+        for (auto &edge : static_cast<IRPhi*>(ir)->incoming) {
+            if (edge.first == old_bid) {
+                edge.first = new_bid;
+            }
+        }
+    }
+}
+
+void simplify_cfg(IRFunction &func) {
+    for (bool changed = true; changed; ) {
+        changed = false;
+
+        // a branch or switch to the same block every way is a jump
+        for (auto block : func.body) {
+            auto targets = block->jump.targets();
+            bool branches = block->jump.jump_type == IRJump::cond || block->jump.jump_type == IRJump::multiway;
+            if (branches && std::all_of(targets.begin(), targets.end(), [&](int target) { return target == targets[0]; })) {
+                block->jump = IRJump::from_direct_jump(targets[0]);
+                changed = true;
+            }
+        }
+
+        // jump straight to where a chain of empty blocks leads; a block
+        // with phis tells its predecessors apart, so chains stop before it,
+        // and a chain running in a circle is left alone
+        std::vector<int> seen(func.body.size(), -1);
+        int walk = 0;
+        auto destination = [&](int target) {
+            walk++;
+            for (int bid = target; ; ) {
+                auto block = func.body[static_cast<size_t>(bid)];
+                if (!block->statements.empty() || block->jump.jump_type != IRJump::direct) {
+                    return bid;
+                }
+                seen[static_cast<size_t>(bid)] = walk;
+                int next = std::get<IRJump::DirectJump>(block->jump.jump).jump_bid;
+                if (seen[static_cast<size_t>(next)] == walk) {
+                    return target;
+                }
+                if (has_phis(func.body[static_cast<size_t>(next)])) {
+                    return bid;
+                }
+                bid = next;
+            }
+        };
+        for (auto block : func.body) {
+            block->jump.visit_targets([&](int &target) {
+                int resolved = destination(target);
+                if (resolved != target) {
+                    target = resolved;
+                    changed = true;
+                }
+            });
+        }
+
+        // a block entered only from the one before it joins that block
+        ControlFlowGraph cfg(func);
+        std::vector<bool> merged(func.body.size());
+        for (int bid : cfg.order) {
+            if (merged[static_cast<size_t>(bid)]) {
+                continue;
+            }
+            auto block = func.body[static_cast<size_t>(bid)];
+            while (block->jump.jump_type == IRJump::direct) {
+                int next = std::get<IRJump::DirectJump>(block->jump.jump).jump_bid;
+                auto next_block = func.body[static_cast<size_t>(next)];
+                if (next == 0 || next == bid || cfg.preds[static_cast<size_t>(next)].size() != 1 || has_phis(next_block)) {
+                    break;
+                }
+                block->statements.insert(block->statements.end(),
+                    next_block->statements.begin(), next_block->statements.end());
+                block->jump = next_block->jump;
+                for (int succ : block->jump.targets()) {
+                    rename_predecessor(func.body[static_cast<size_t>(succ)], next, bid);
+                }
+                next_block->statements.clear();
+                next_block->jump = IRJump();
+                merged[static_cast<size_t>(next)] = true;
+                changed = true;
+            }
+        }
+
+        if (renumber_blocks(func)) {
+            changed = true;
+        }
+    }
+}
@@ -0,0 +1,176 @@
+#include <map>
+#include <tuple>
+#include <unordered_map>
+
+#include "cfg.hpp"
+#include "pass.hpp"
+
+namespace {
+
+// operand type, slot, pool index
+using OperandKey = std::tuple<int, int, uint32_t>;
+// operation, type of the result, operands, memory version of a load
+using ExpressionKey = std::tuple<int, Type*, OperandKey, OperandKey, int>;
+
+OperandKey key_of(const IRValue &value) {
+    return OperandKey(value.type, value.get_slot(),
+        value.type == IROpearndType::constant ? value.payload : 0);
+}
+
+bool is_commutative(IROptype type) {
+    return type == IROptype::add || type == IROptype::mul ||
+        type == IROptype::land || type == IROptype::lor;
+}
+
+// Dominator-based value numbering in the manner of Briggs, Cooper and
+// Simpson: an expression computed again in a block its first computation
+// dominates is replaced by that first result.
+class ValueNumbering {
+public:
+    ValueNumbering(IRFunction &n_func) : func(n_func), cfg(n_func) {}
+
+    void run() {
+        // operands that do not stand for a single value
+        mutable_slots = find_written_slots(func);
+
+        std::vector<int> memory_at_exit(func.body.size(), -1);
+        std::vector<std::vector<ExpressionKey>> inserted(func.body.size());
+        std::vector<std::pair<int, bool>> walk { { 0, false } };
+        int next_memory = 0;
+        while (!walk.empty()) {
+            size_t bid = static_cast<size_t>(walk.back().first);
+            bool leaving = walk.back().second;
+            walk.pop_back();
+            if (leaving) {
+                for (auto &key : inserted[bid]) {
+                    available.erase(key);
+                }
+                continue;
+            }
+            walk.push_back({ static_cast<int>(bid), true });
+
+            // memory is known to be unchanged only when the block is
+            // entered from its dominator alone
+            int idom = cfg.idom[bid];
+            int memory = idom >= 0 && cfg.preds[bid].size() == 1 && cfg.preds[bid][0] == idom ?
+                memory_at_exit[static_cast<size_t>(idom)] : next_memory++;
+
+            auto block = func.body[bid];
+            std::vector<IR*> statements;
+            for (auto ir : block->statements) {
+                ir->visit_operands([&](IRValue &value) { forward(value); });
+                if (ir->type == IROptype::store || ir->type == IROptype::call) {
+                    memory = next_memory++;
+                }
+                ExpressionKey key;
+                if (!expression_of(ir, memory, key)) {
+                    statements.push_back(ir);
+                    continue;
+                }
+                auto it = available.find(key);
+                if (it != available.end()) {
+                    replacements.emplace(ir->result_slot, it->second);
+                    continue;
+                }
+                available.emplace(key, IRValue::from_temp(ir->result_type(), ir->result_slot));
+                inserted[bid].push_back(key);
+                statements.push_back(ir);
+            }
+            block->statements = std::move(statements);
+            if (auto value = block->jump.operand()) {
+                forward(*value);
+            }
+            memory_at_exit[bid] = memory;
+
+            for (int child : cfg.dom_children[bid]) {
+                walk.push_back({ child, false });
+            }
+        }
+
+        // phis read values along back edges, after their blocks were seen
+        for (auto block : func.body) {
+            for (auto ir : block->statements) {
+                if (ir->type == IROptype::phi) {
+                    ir->visit_operands([&](IRValue &value) { forward(value); });
+                }
+            }
+        }
+    }
+
+private:
+    IRFunction &func;
+    ControlFlowGraph cfg;
+    std::vector<bool> mutable_slots;
+    std::map<ExpressionKey, IRValue> available;
+    // result slot of a removed instruction -> the equal value kept
+    std::unordered_map<int, IRValue> replacements;
+
+    void forward(IRValue &value) {
+        if (value.type != IROpearndType::temp) {
+            return;
+        }
+        auto it = replacements.find(value.get_slot());
+        if (it != replacements.end()) {
+            value = it->second;
+        }
+    }
+
+    bool is_stable(const IRValue &value) {
+        return value.type == IROpearndType::constant ||
+            ((value.type == IROpearndType::temp || value.type == IROpearndType::id) &&
+                value.get_slot() >= 0 && !mutable_slots[static_cast<size_t>(value.get_slot())]);
+    }
+
+    bool expression_of(IR* ir, int memory, ExpressionKey &key) {
+        if (ir->result_slot < 0 || mutable_slots[static_cast<size_t>(ir->result_slot)]) {
+            return false;
+        }
+        switch (ir->type) {
+        case IROptype::typecast: {
+            auto cast = static_cast<IRCast*>(ir);
+            if (!is_stable(cast->value)) {
+                return false;
+            }
+            key = ExpressionKey(ir->type, cast->target_type, key_of(cast->value), OperandKey(), 0);
+            return true;
+        }
+        case IROptype::array_index: {
+            auto array_index = static_cast<IRArrayIndex*>(ir);
+            if (!is_stable(array_index->array) || !is_stable(array_index->index)) {
+                return false;
+            }
+            key = ExpressionKey(ir->type, ir->result_type(), key_of(array_index->array), key_of(array_index->index), 0);
+            return true;
+        }
+        case IROptype::load: {
+            auto load = static_cast<IRLoad*>(ir);
+            if (!is_stable(load->pointer)) {
+                return false;
+            }
+            key = ExpressionKey(ir->type, ir->result_type(), key_of(load->pointer), OperandKey(), memory);
+            return true;
+        }
+        default:
+            break;
+        }
+        if (has_side_effects(ir->type) || ir->type == IROptype::phi) {
+            return false;
+        }
+        auto binary = static_cast<IRBinary*>(ir);
+        if (!is_stable(binary->lhs) || !is_stable(binary->rhs)) {
+            return false;
+        }
+        auto lhs = key_of(binary->lhs), rhs = key_of(binary->rhs);
+        if (is_commutative(ir->type) && rhs < lhs) {
+            std::swap(lhs, rhs);
+        }
+        key = ExpressionKey(ir->type, binary->lhs.value_type, lhs, rhs, 0);
+        return true;
+    }
+};
+
+}
+
+void number_values(IRFunction &func) {
+    ValueNumbering(func).run();
+}
@@ -0,0 +1,286 @@
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include "cfg.hpp"
+#include "pass.hpp"
+
+namespace {
+
+// a callee this size is always inlined, one called in a loop up to four
+// times more; a caller stops growing at max_caller_size
+const size_t inline_threshold = 16;
+const int max_loop_boost = 2;
+const size_t max_caller_size = 2000;
+
+// instructions plus one per block for its jump
+size_t size_of(IRFunction &func) {
+    size_t size = func.body.size();
+    for (auto block : func.body) {
+        size += block->statements.size();
+    }
+    return size;
+}
+
+bool is_scalar(Type* type) {
+    return type->type_id == Type::TypeID::IntegerTyID || type->type_id == Type::TypeID::FloatTyID ||
+        type->type_id == Type::TypeID::DoubleTyID;
+}
+
+IRValue zero_of(IRFunction &func, Type* type) {
+    switch (ir_kind_of(type)) {
+    case IRKind::f32: return func.add_constant(type, Value::from_float(0.0f));
+    case IRKind::f64: return func.add_constant(type, Value::from_double(0.0));
+    default: return func.add_constant(type, Value::from_int(0));
+    }
+}
+
+// Callees are copied into callers in place of their calls, callees first
+// so that what they inline is inlined along with them. Functions on a
+// cycle of the call graph are never inlined.
+class Inliner {
+public:
+    Inliner(CodeGenContext &n_module) : module(n_module) {}
+
+    void run() {
+        for (auto &item : module.func_defs) {
+            auto func = item.second.get();
+            index_of[func] = functions.size();
+            functions.push_back(func);
+        }
+        callees.resize(functions.size());
+        for (size_t i = 0; i < functions.size(); i++) {
+            for (auto block : functions[i]->body) {
+                for (auto ir : block->statements) {
+                    if (ir->type == IROptype::call) {
+                        callees[i].push_back(index_of.at(static_cast<IRMethodCall*>(ir)->callee));
+                    }
+                }
+            }
+        }
+        find_recursion();
+        for (size_t func : callee_order) {
+            inline_calls(*functions[func]);
+        }
+    }
+
+private:
+    CodeGenContext &module;
+    std::vector<IRFunction*> functions;
+    std::unordered_map<const IRFunction*, size_t> index_of;
+    std::vector<std::vector<size_t>> callees;
+    std::vector<bool> recursive;
+    // every function after all it calls, cycles aside
+    std::vector<size_t> callee_order;
+
+    // Tarjan's strongly connected components; they are completed callees
+    // first
+    void find_recursion() {
+        size_t count = functions.size();
+        recursive.assign(count, false);
+        std::vector<int> number(count, -1), low(count);
+        std::vector<size_t> stack;
+        std::vector<bool> on_stack(count);
+        int next_number = 0;
+        std::function<void(size_t)> visit = [&](size_t func) {
+            number[func] = low[func] = next_number++;
+            stack.push_back(func);
+            on_stack[func] = true;
+            for (size_t callee : callees[func]) {
+                if (number[callee] < 0) {
+                    visit(callee);
+                    low[func] = std::min(low[func], low[callee]);
+                } else if (on_stack[callee]) {
+                    low[func] = std::min(low[func], number[callee]);
+                }
+            }
+            if (low[func] != number[func]) {
+                return;
+            }
+            std::vector<size_t> component;
+            size_t top;
+            do {
+                top = stack.back();
+                stack.pop_back();
+                on_stack[top] = false;
+                component.push_back(top);
+            } while (top != func);
+            bool calls_itself = std::find(callees[func].begin(), callees[func].end(), func) != callees[func].end();
+            for (size_t member : component) {
+                recursive[member] = component.size() > 1 || calls_itself;
+                callee_order.push_back(member);
+            }
+        };
+        for (size_t func = 0; func < count; func++) {
+            if (number[func] < 0) {
+                visit(func);
+            }
+        }
+    }
+
+    // a callee whose frame holds only scalars, so that its locals can
+    // live among the caller's and be zeroed on every entry
+    bool can_inline(IRMethodCall* call) {
+        auto callee = call->callee;
+        if (recursive[index_of.at(callee)] || call->arguments.size() != callee->arg_vec.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < call->arguments.size(); i++) {
+            if (call->arguments[i].value_type != callee->arg_vec[i].value_type || !is_scalar(callee->arg_vec[i].value_type)) {
+                return false;
+            }
+        }
+        for (auto &decl : callee->decl_vec) {
+            if (!is_scalar(decl.value_type)) {
+                return false;
+            }
+        }
+        auto return_type = callee->return_type;
+        return return_type->type_id == Type::TypeID::VoidTyID || is_scalar(return_type);
+    }
+
+    void inline_calls(IRFunction &func) {
+        // calls in loops are taken to run more often
+        ControlFlowGraph cfg(func);
+        std::vector<int> loop_depth(func.body.size());
+        for (auto &loop : find_loops(cfg)) {
+            for (int bid : loop.blocks) {
+                loop_depth[static_cast<size_t>(bid)]++;
+            }
+        }
+
+        size_t size = size_of(func);
+        for (size_t bid = 0; bid < func.body.size(); bid++) {
+            auto block = func.body[bid];
+            for (size_t i = 0; i < block->statements.size(); i++) {
+                auto ir = block->statements[i];
+                if (ir->type != IROptype::call) {
+                    continue;
+                }
+                auto call = static_cast<IRMethodCall*>(ir);
+                if (!can_inline(call)) {
+                    continue;
+                }
+                size_t callee_size = size_of(*call->callee);
+                size_t threshold = inline_threshold << std::min(loop_depth[bid], max_loop_boost);
+                if (callee_size > threshold || size + callee_size > max_caller_size) {
+                    continue;
+                }
+                inline_call(func, bid, i);
+                size += callee_size;
+                loop_depth.resize(func.body.size(), loop_depth[bid]);
+                // the rest of the block moved to its continuation
+                break;
+            }
+        }
+    }
+
+    // Splits the block at the call: the part before it assigns the
+    // parameters and enters a copy of the callee, whose returns store the
+    // result and jump to a continuation holding the rest of the block.
+    void inline_call(IRFunction &func, size_t bid, size_t index) {
+        auto block = func.body[bid];
+        auto call = static_cast<IRMethodCall*>(block->statements[index]);
+        IRFunction &callee = *call->callee;
+
+        // the callee's variables become hidden locals, its temps new temps
+        std::vector<int> slot_map(static_cast<size_t>(callee.slot_count), -1);
+        std::vector<IRValue> params, locals;
+        for (auto &arg : callee.arg_vec) {
+            params.push_back(func.add_hidden_decl(arg.get_symbol(), arg.value_type));
+            slot_map[static_cast<size_t>(arg.get_slot())] = params.back().get_slot();
+        }
+        for (auto &decl : callee.decl_vec) {
+            locals.push_back(func.add_hidden_decl(decl.get_symbol(), decl.value_type));
+            slot_map[static_cast<size_t>(decl.get_slot())] = locals.back().get_slot();
+        }
+        for (auto &slot : slot_map) {
+            if (slot < 0) {
+                slot = func.add_slot();
+            }
+        }
+        auto remap = [&](IRValue &value) {
+            if (value.type == IROpearndType::constant) {
+                size_t constant = value.get_constant_index();
+                value = func.add_constant(callee.constants[constant], callee.constant_values[constant]);
+            } else if ((value.type == IROpearndType::id || value.type == IROpearndType::temp) && value.get_slot() >= 0) {
+                value.set_slot(slot_map[static_cast<size_t>(value.get_slot())]);
+            }
+        };
+
+        bool has_result = call->result_slot >= 0;
+        static const Symbol return_name = SymbolTable::global().intern("return");
+        IRValue result = has_result ? func.add_hidden_decl(return_name, callee.return_type) :
+            IRValue(IROpearndType::unknown_operand, callee.return_type);
+
+        int first_bid = static_cast<int>(func.body.size());
+        int continuation_bid = first_bid + static_cast<int>(callee.body.size());
+        for (auto callee_block : callee.body) {
+            auto copy = func.arena.make<IRBlock>(static_cast<int>(func.body.size()));
+            func.body.push_back(copy);
+            for (auto ir : callee_block->statements) {
+                auto statement = ir->clone(func.arena);
+                statement->visit_operands(remap);
+                if (statement->result_slot >= 0) {
+                    statement->result_slot = slot_map[static_cast<size_t>(statement->result_slot)];
+                }
+                copy->statements.push_back(statement);
+            }
+            auto &jump = callee_block->jump;
+            if (jump.jump_type == IRJump::ret || jump.jump_type == IRJump::unknown) {
+                // falling off the end returns as well
+                if (jump.jump_type == IRJump::ret && has_result) {
+                    IRValue value = std::get<IRJump::RetJump>(jump.jump).return_value;
+                    remap(value);
+                    copy->statements.push_back(func.arena.make<IRBinary>(IROptype::assign, result, value));
+                }
+                copy->jump = IRJump::from_direct_jump(continuation_bid);
+            } else {
+                copy->jump = jump;
+                copy->jump.visit_targets([&](int &target) { target += first_bid; });
+                if (auto value = copy->jump.operand()) {
+                    remap(*value);
+                }
+            }
+        }
+
+        auto continuation = func.arena.make<IRBlock>(continuation_bid);
+        func.body.push_back(continuation);
+        continuation->statements.assign(block->statements.begin() + static_cast<std::ptrdiff_t>(index) + 1, block->statements.end());
+        continuation->jump = block->jump;
+
+        // locals start out as 0 on every call, as they do in a new frame
+        block->statements.resize(index);
+        for (size_t i = 0; i < params.size(); i++) {
+            block->statements.push_back(func.arena.make<IRBinary>(IROptype::assign, params[i], call->arguments[i]));
+        }
+        for (auto &local : locals) {
+            block->statements.push_back(func.arena.make<IRBinary>(IROptype::assign, local, zero_of(func, local.value_type)));
+        }
+        block->jump = IRJump::from_direct_jump(first_bid);
+
+        // the call's temp is read from the result local instead
+        if (has_result) {
+            int result_slot = call->result_slot;
+            auto replace = [&](IRValue &value) {
+                if (value.type == IROpearndType::temp && value.get_slot() == result_slot) {
+                    value = result;
+                }
+            };
+            for (auto each : func.body) {
+                for (auto ir : each->statements) {
+                    ir->visit_operands(replace);
+                }
+                if (auto value = each->jump.operand()) {
+                    replace(*value);
+                }
+            }
+        }
+    }
+};
+
+}
+
+void inline_functions(CodeGenContext &context) {
+    Inliner(context).run();
+}
@@ -0,0 +1,235 @@
+#include <type_traits>
+
+#include "ir.hpp"
+
+// Integers are kept sign-extended to 64 bits in Value::i whatever their
+// width; floats live in the member of their own width.
+template <typename T>
+struct ValueTraits {
+    static T get(Value value) {
+        return static_cast<T>(value.i);
+    }
+
+    static Value make(T n_value) {
+        return Value::from_int(static_cast<uint64_t>(n_value));
+    }
+};
+
+template <>
+struct ValueTraits<float> {
+    static float get(Value value) {
+        return value.f;
+    }
+
+    static Value make(float n_value) {
+        return Value::from_float(n_value);
+    }
+};
+
+template <>
+struct ValueTraits<double> {
+    static double get(Value value) {
+        return value.d;
+    }
+
+    static Value make(double n_value) {
+        return Value::from_double(n_value);
+    }
+};
+
+// signed overflow wraps around, as it does in the bytecode VM
+template <typename T, typename Op>
+T wrapping(T lhs, T rhs, Op op) {
+    if constexpr (std::is_integral_v<T>) {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<T>(op(static_cast<U>(lhs), static_cast<U>(rhs)));
+    } else {
+        return op(lhs, rhs);
+    }
+}
+
+struct AddOp {
+    template <typename T> T operator()(T lhs, T rhs) const { return wrapping(lhs, rhs, [](auto a, auto b) { return a + b; }); }
+};
+
+struct SubOp {
+    template <typename T> T operator()(T lhs, T rhs) const { return wrapping(lhs, rhs, [](auto a, auto b) { return a - b; }); }
+};
+
+struct MulOp {
+    template <typename T> T operator()(T lhs, T rhs) const { return wrapping(lhs, rhs, [](auto a, auto b) { return a * b; }); }
+};
+
+struct DivOp {
+    template <typename T> T operator()(T lhs, T rhs) const { return lhs / rhs; }
+};
+
+struct LessOp {
+    template <typename T> bool operator()(T lhs, T rhs) const { return lhs < rhs; }
+};
+
+struct GreaterOp {
+    template <typename T> bool operator()(T lhs, T rhs) const { return lhs > rhs; }
+};
+
+struct LessEqualOp {
+    template <typename T> bool operator()(T lhs, T rhs) const { return lhs <= rhs; }
+};
+
+struct GreaterEqualOp {
+    template <typename T> bool operator()(T lhs, T rhs) const { return lhs >= rhs; }
+};
+
+struct AndOp {
+    template <typename T> bool operator()(T lhs, T rhs) const { return lhs && rhs; }
+};
+
+struct OrOp {
+    template <typename T> bool operator()(T lhs, T rhs) const { return lhs || rhs; }
+};
+
+template <typename T, typename Op>
+Value arith_kernel(Value lhs, Value rhs) {
+    return ValueTraits<T>::make(Op()(ValueTraits<T>::get(lhs), ValueTraits<T>::get(rhs)));
+}
+
+// comparisons produce an i32 holding 0 or 1
+template <typename T, typename Op>
+Value compare_kernel(Value lhs, Value rhs) {
+    return ValueTraits<int32_t>::make(Op()(ValueTraits<T>::get(lhs), ValueTraits<T>::get(rhs)) ? 1 : 0);
+}
+
+template <typename T>
+Value inc_kernel(Value value) {
+    return ValueTraits<T>::make(AddOp()(ValueTraits<T>::get(value), T(1)));
+}
+
+template <typename T>
+Value dec_kernel(Value value) {
+    return ValueTraits<T>::make(SubOp()(ValueTraits<T>::get(value), T(1)));
+}
+
+template <typename From, typename To>
+Value cast_kernel(Value value) {
+    return ValueTraits<To>::make(static_cast<To>(ValueTraits<From>::get(value)));
+}
+
+static Value identity_kernel(Value value) {
+    return value;
+}
+
+template <typename T>
+Value load_kernel(const void* pointer) {
+    return ValueTraits<T>::make(*static_cast<const T*>(pointer));
+}
+
+template <typename T>
+void store_kernel(void* pointer, Value value) {
+    *static_cast<T*>(pointer) = ValueTraits<T>::get(value);
+}
+
+template <typename Op>
+static BinaryKernel select_arith(IRKind kind) {
+    switch (kind) {
+    case IRKind::i32: return arith_kernel<int32_t, Op>;
+    case IRKind::i64: return arith_kernel<int64_t, Op>;
+    case IRKind::f32: return arith_kernel<float, Op>;
+    case IRKind::f64: return arith_kernel<double, Op>;
+    default: return nullptr;
+    }
+}
+
+template <typename Op>
+static BinaryKernel select_compare(IRKind kind) {
+    switch (kind) {
+    case IRKind::i32: return compare_kernel<int32_t, Op>;
+    case IRKind::i64: return compare_kernel<int64_t, Op>;
+    case IRKind::f32: return compare_kernel<float, Op>;
+    case IRKind::f64: return compare_kernel<double, Op>;
+    default: return nullptr;
+    }
+}
+
+BinaryKernel select_binary_kernel(IROptype op, IRKind kind) {
+    switch (op) {
+    case IROptype::add: return select_arith<AddOp>(kind);
+    case IROptype::minus: return select_arith<SubOp>(kind);
+    case IROptype::mul: return select_arith<MulOp>(kind);
+    case IROptype::divide: return select_arith<DivOp>(kind);
+    case IROptype::less: return select_compare<LessOp>(kind);
+    case IROptype::greater: return select_compare<GreaterOp>(kind);
+    case IROptype::less_equal: return select_compare<LessEqualOp>(kind);
+    case IROptype::greater_equal: return select_compare<GreaterEqualOp>(kind);
+    case IROptype::land: return select_compare<AndOp>(kind);
+    case IROptype::lor: return select_compare<OrOp>(kind);
+    default: return nullptr;
+    }
+}
+
+UnaryKernel select_unary_kernel(IROptype op, IRKind kind) {
+    bool is_inc = op == IROptype::inc;
+    if (!is_inc && op != IROptype::dec) {
+        return nullptr;
+    }
+    switch (kind) {
+    case IRKind::i8: return is_inc ? inc_kernel<int8_t> : dec_kernel<int8_t>;
+    case IRKind::i16: return is_inc ? inc_kernel<int16_t> : dec_kernel<int16_t>;
+    case IRKind::i32: return is_inc ? inc_kernel<int32_t> : dec_kernel<int32_t>;
+    case IRKind::i64: return is_inc ? inc_kernel<int64_t> : dec_kernel<int64_t>;
+    case IRKind::f32: return is_inc ? inc_kernel<float> : dec_kernel<float>;
+    case IRKind::f64: return is_inc ? inc_kernel<double> : dec_kernel<double>;
+    default: return nullptr;
+    }
+}
+
+template <typename From>
+static UnaryKernel select_cast_from(IRKind to) {
+    switch (to) {
+    case IRKind::i8: return cast_kernel<From, int8_t>;
+    case IRKind::i16: return cast_kernel<From, int16_t>;
+    case IRKind::i32: return cast_kernel<From, int32_t>;
+    case IRKind::i64: return cast_kernel<From, int64_t>;
+    case IRKind::f32: return cast_kernel<From, float>;
+    case IRKind::f64: return cast_kernel<From, double>;
+    default: return nullptr;
+    }
+}
+
+UnaryKernel select_cast_kernel(IRKind from, IRKind to) {
+    if (from == to) {
+        return identity_kernel;
+    }
+    switch (from) {
+    case IRKind::i8: return select_cast_from<int8_t>(to);
+    case IRKind::i16: return select_cast_from<int16_t>(to);
+    case IRKind::i32: return select_cast_from<int32_t>(to);
+    case IRKind::i64: return select_cast_from<int64_t>(to);
+    case IRKind::f32: return select_cast_from<float>(to);
+    case IRKind::f64: return select_cast_from<double>(to);
+    default: return nullptr;
+    }
+}
+
+LoadKernel select_load_kernel(IRKind kind) {
+    switch (kind) {
+    case IRKind::i8: return load_kernel<int8_t>;
+    case IRKind::i16: return load_kernel<int16_t>;
+    case IRKind::i32: return load_kernel<int32_t>;
+    case IRKind::i64: return load_kernel<int64_t>;
+    case IRKind::f32: return load_kernel<float>;
+    case IRKind::f64: return load_kernel<double>;
+    default: return nullptr;
+    }
+}
+
+StoreKernel select_store_kernel(IRKind kind) {
+    switch (kind) {
+    case IRKind::i8: return store_kernel<int8_t>;
+    case IRKind::i16: return store_kernel<int16_t>;
+    case IRKind::i32: return store_kernel<int32_t>;
+    case IRKind::i64: return store_kernel<int64_t>;
+    case IRKind::f32: return store_kernel<float>;
+    case IRKind::f64: return store_kernel<double>;
+    default: return nullptr;
+    }
+}
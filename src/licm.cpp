@@ -0,0 +1,150 @@
+#include <algorithm>
+
+#include "cfg.hpp"
+#include "pass.hpp"
+
+// Gives every loop without a preheader a new block that all entries from
+// outside the loop now pass through. Header phis take one value from it,
+// merged by a phi of its own when the entries disagree.
+static bool add_preheaders(IRFunction &func, const ControlFlowGraph &cfg, const std::vector<Loop> &loops) {
+    bool added = false;
+    for (auto &loop : loops) {
+        if (loop.preheader >= 0 || loop.header == 0) {
+            continue;
+        }
+        int header = loop.header;
+        std::vector<int> outside;
+        for (int pred : cfg.preds[static_cast<size_t>(header)]) {
+            if (!loop.contains(pred)) {
+                outside.push_back(pred);
+            }
+        }
+
+        auto preheader = func.arena.make<IRBlock>(static_cast<int>(func.body.size()));
+        func.body.push_back(preheader);
+        preheader->jump = IRJump::from_direct_jump(header);
+        for (int pred : outside) {
+            func.body[static_cast<size_t>(pred)]->jump.replace_target(header, preheader->bid);
+        }
+
+        for (auto ir : func.body[static_cast<size_t>(header)]->statements) {
+            if (ir->type != IROptype::phi) {
+                break;
+            }
+            auto phi = static_cast<IRPhi*>(ir);
+            std::vector<std::pair<int, IRValue>> entering, looping;
+            for (auto &edge : phi->incoming) {
+                (loop.contains(edge.first) ? looping : entering).push_back(edge);
+            }
+            IRValue value = entering.front().second;
+            bool agree = std::all_of(entering.begin(), entering.end(), [&](const std::pair<int, IRValue> &edge) {
+                return edge.second.type == value.type && edge.second.get_slot() == value.get_slot() &&
+                    edge.second.payload == value.payload;
+            });
+            if (!agree) {
+                auto merge = func.arena.make<IRPhi>(phi->value_type);
+                merge->result_slot = func.add_slot();
+                merge->incoming = entering;
+                preheader->statements.push_back(merge);
+                value = IRValue::from_temp(phi->value_type, merge->result_slot);
+            }
+            looping.push_back({ preheader->bid, value });
+            phi->incoming = looping;
+        }
+        added = true;
+    }
+    return added;
+}
+
+void hoist_loop_invariants(IRFunction &func) {
+    ControlFlowGraph cfg(func);
+    auto loops = find_loops(cfg);
+    if (loops.empty()) {
+        return;
+    }
+    if (add_preheaders(func, cfg, loops)) {
+        cfg = ControlFlowGraph(func);
+        loops = find_loops(cfg);
+    }
+
+    auto written = find_written_slots(func);
+    std::vector<int> def_block(static_cast<size_t>(func.slot_count), -1);
+    for (size_t bid = 0; bid < func.body.size(); bid++) {
+        for (auto ir : func.body[bid]->statements) {
+            if (ir->result_slot >= 0) {
+                def_block[static_cast<size_t>(ir->result_slot)] = static_cast<int>(bid);
+            }
+        }
+    }
+
+    for (auto &loop : loops) {
+        if (loop.preheader < 0) {
+            continue;
+        }
+        auto preheader = func.body[static_cast<size_t>(loop.preheader)];
+
+        std::vector<int> exits;
+        bool writes_memory = false;
+        for (int bid : loop.blocks) {
+            auto &succs = cfg.succs[static_cast<size_t>(bid)];
+            if (std::any_of(succs.begin(), succs.end(), [&](int succ) { return !loop.contains(succ); })) {
+                exits.push_back(bid);
+            }
+            for (auto ir : func.body[static_cast<size_t>(bid)]->statements) {
+                writes_memory = writes_memory || ir->type == IROptype::store || ir->type == IROptype::call;
+            }
+        }
+
+        auto is_invariant = [&](const IRValue &value) {
+            switch (value.type) {
+            case IROpearndType::constant:
+                return true;
+            case IROpearndType::id:
+                return value.get_slot() >= 0 && !written[static_cast<size_t>(value.get_slot())];
+            case IROpearndType::temp: {
+                size_t slot = static_cast<size_t>(value.get_slot());
+                return !written[slot] && !loop.contains(def_block[slot]);
+            }
+            default:
+                return false;
+            }
+        };
+
+        // blocks in reverse postorder see the definitions they read first
+        for (int bid : cfg.order) {
+            if (!loop.contains(bid)) {
+                continue;
+            }
+            // a load or a division may fault, it is only moved when the
+            // loop runs it whenever it runs at all
+            bool always_runs = !exits.empty() && std::all_of(exits.begin(), exits.end(), [&](int exit) {
+                return cfg.dominates(bid, exit);
+            });
+            auto block = func.body[static_cast<size_t>(bid)];
+            std::vector<IR*> statements;
+            for (auto ir : block->statements) {
+                bool hoist = ir->type != IROptype::phi && !has_side_effects(ir->type) &&
+                    ir->result_slot >= 0 && !written[static_cast<size_t>(ir->result_slot)];
+                if (hoist) {
+                    ir->visit_operands([&](IRValue &value) {
+                        hoist = hoist && is_invariant(value);
+                    });
+                }
+                if (hoist && ir->type == IROptype::load) {
+                    hoist = !writes_memory && always_runs;
+                }
+                if (hoist && ir->type == IROptype::divide) {
+                    auto kind = static_cast<IRBinary*>(ir)->kind;
+                    hoist = kind == IRKind::f32 || kind == IRKind::f64 || always_runs;
+                }
+                if (hoist) {
+                    preheader->statements.push_back(ir);
+                    def_block[static_cast<size_t>(ir->result_slot)] = loop.preheader;
+                } else {
+                    statements.push_back(ir);
+                }
+            }
+            block->statements = std::move(statements);
+        }
+    }
+}
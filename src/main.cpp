@@ -10,24 +10,70 @@
 #include <iostream>
 #include <vector>
 #include <memory>
+#include <string>
 
-#include "node.hpp"
-#include "semic_grammar.hpp"
+#include <stdexcept>
+
+#include "compiler.hpp"
+#include "source.hpp"
 #include "sim.hpp"
+#include "vm.hpp"
 
-extern int yyparse();
-extern int column;
-extern std::vector<std::shared_ptr<NFunction>> programBlocks; /* the top level root node of our final AST */
+int main(int argc, char** argv) {
+    // --vm runs the bytecode engine instead of the IR simulator,
+    // --echo copies the source to stdout while it is parsed,
+    // --no-opt runs the IR as generated,
+    // --inline also inlines small functions, whose calls are then no
+    // longer traced,
+    // --no-dump leaves out the IR printed before the program runs,
+    // --jobs N generates the function bodies on up to N threads.
+    // The program is read from the named file, or from stdin.
+    bool use_vm = false, dump_bytecode = false, dump_ir = true;
+    Compiler compiler;
+    std::string path;
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg == "--vm") {
+            use_vm = true;
+        } else if (arg == "--dump-bytecode") {
+            use_vm = dump_bytecode = true;
+        } else if (arg == "--echo") {
+            compiler.echo = true;
+        } else if (arg == "--no-opt") {
+            compiler.optimize = false;
+        } else if (arg == "--no-dump") {
+            dump_ir = false;
+        } else if (arg == "--inline") {
+            compiler.inline_calls = true;
+        } else if (arg == "--jobs" && i + 1 < argc) {
+            compiler.jobs = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else {
+            path = arg;
+        }
+    }
 
-int main() {
-    yyparse();
-    std::cout << "<parse end>" << '\n';
-    CodeGenContext cur_context;
-    for(auto func_decl : programBlocks) {
-        func_decl->codeGen(cur_context);
+    try {
+        SourceFile source = SourceFile::open(path);
+        std::unique_ptr<CodeGenContext> context = compiler.compile(source);
+        std::cout << "<parse end>" << '\n';
+        if (dump_ir) {
+            context->print();
+        }
+        if (use_vm) {
+            BytecodeModule module = lower_to_bytecode(*context);
+            if (dump_bytecode) {
+                module.print();
+            }
+            VirtualMachine vm(module);
+            vm.run();
+        } else {
+            Simulator sim(context.get());
+            sim.run();
+        }
+    } catch (const std::runtime_error &error) {
+        std::cout.flush();
+        std::cerr << error.what() << '\n';
+        return 1;
     }
-    cur_context.print();
-    Simulator sim(&cur_context);
-    sim.run();
     std::cout << "<finished>" << '\n';
 }
@@ -0,0 +1,324 @@
+#include <set>
+
+#include "cfg.hpp"
+#include "pass.hpp"
+
+namespace {
+
+// What is known about a temp: nothing yet, one value, or that it varies.
+struct LatticeCell {
+    enum State : uint8_t {
+        undefined,
+        constant,
+        varying,
+    };
+
+    State state = undefined;
+    Value value {};
+
+    static LatticeCell from_constant(Value n_value) {
+        LatticeCell cell;
+        cell.state = constant;
+        cell.value = n_value;
+        return cell;
+    }
+
+    static LatticeCell from_varying() {
+        LatticeCell cell;
+        cell.state = varying;
+        return cell;
+    }
+
+    LatticeCell meet(const LatticeCell &other) const {
+        if (state == undefined) {
+            return other;
+        }
+        if (other.state == undefined) {
+            return *this;
+        }
+        if (state == constant && other.state == constant && value.i == other.value.i) {
+            return *this;
+        }
+        return from_varying();
+    }
+
+    bool operator!=(const LatticeCell &other) const {
+        return state != other.state || (state == constant && value.i != other.value.i);
+    }
+};
+
+// Wegman and Zadeck, "Constant Propagation with Conditional Branches".
+// Values are computed with the kernels the simulator runs, so a folded
+// result is bit for bit what execution would have produced.
+class ConstantPropagation {
+public:
+    ConstantPropagation(IRFunction &n_func) :
+        func(n_func), cells(static_cast<size_t>(n_func.slot_count)), uses(static_cast<size_t>(n_func.slot_count)),
+        jump_uses(static_cast<size_t>(n_func.slot_count)), visited(n_func.body.size()) {}
+
+    void run() {
+        for (size_t bid = 0; bid < func.body.size(); bid++) {
+            auto block = func.body[bid];
+            for (auto ir : block->statements) {
+                ir->visit_operands([&](IRValue &value) {
+                    if (value.type == IROpearndType::temp) {
+                        uses[static_cast<size_t>(value.get_slot())].push_back({ static_cast<int>(bid), ir });
+                    }
+                });
+            }
+            if (auto value = block->jump.operand()) {
+                if (value->type == IROpearndType::temp) {
+                    jump_uses[static_cast<size_t>(value->get_slot())].push_back(static_cast<int>(bid));
+                }
+            }
+        }
+
+        flow_worklist.push_back({ -1, 0 });
+        while (!flow_worklist.empty() || !value_worklist.empty()) {
+            while (!flow_worklist.empty()) {
+                auto edge = flow_worklist.back();
+                flow_worklist.pop_back();
+                if (!executable.insert(edge).second) {
+                    continue;
+                }
+                int bid = edge.second;
+                auto block = func.body[static_cast<size_t>(bid)];
+                for (auto ir : block->statements) {
+                    if (ir->type == IROptype::phi) {
+                        visit_phi(bid, static_cast<IRPhi*>(ir));
+                    }
+                }
+                if (visited[static_cast<size_t>(bid)]) {
+                    continue;
+                }
+                visited[static_cast<size_t>(bid)] = true;
+                for (auto ir : block->statements) {
+                    if (ir->type != IROptype::phi) {
+                        visit(ir);
+                    }
+                }
+                visit_jump(bid);
+            }
+            while (!value_worklist.empty()) {
+                size_t slot = static_cast<size_t>(value_worklist.back());
+                value_worklist.pop_back();
+                for (auto &use : uses[slot]) {
+                    if (!visited[static_cast<size_t>(use.first)]) {
+                        continue;
+                    }
+                    if (use.second->type == IROptype::phi) {
+                        visit_phi(use.first, static_cast<IRPhi*>(use.second));
+                    } else {
+                        visit(use.second);
+                    }
+                }
+                for (int bid : jump_uses[slot]) {
+                    if (visited[static_cast<size_t>(bid)]) {
+                        visit_jump(bid);
+                    }
+                }
+            }
+        }
+
+        rewrite();
+    }
+
+private:
+    IRFunction &func;
+    // indexed by slot
+    std::vector<LatticeCell> cells;
+    std::vector<std::vector<std::pair<int, IR*>>> uses;
+    std::vector<std::vector<int>> jump_uses;
+    // indexed by bid
+    std::vector<bool> visited;
+    // edges taken so far, the entry is reached from -1
+    std::set<std::pair<int, int>> executable;
+    std::vector<std::pair<int, int>> flow_worklist;
+    std::vector<int> value_worklist;
+
+    LatticeCell cell_of(const IRValue &value) {
+        switch (value.type) {
+        case IROpearndType::constant:
+            return LatticeCell::from_constant(func.constant_values[value.get_constant_index()]);
+        case IROpearndType::temp:
+            return cells[static_cast<size_t>(value.get_slot())];
+        default:
+            // parameters and the variables left in slots
+            return LatticeCell::from_varying();
+        }
+    }
+
+    void update(int slot, const LatticeCell &cell) {
+        if (slot < 0) {
+            return;
+        }
+        auto &current = cells[static_cast<size_t>(slot)];
+        auto merged = current.meet(cell);
+        if (merged != current) {
+            current = merged;
+            value_worklist.push_back(slot);
+        }
+    }
+
+    void visit_phi(int bid, IRPhi* phi) {
+        LatticeCell cell;
+        for (auto &edge : phi->incoming) {
+            if (executable.count({ edge.first, bid })) {
+                cell = cell.meet(cell_of(edge.second));
+            }
+        }
+        update(phi->result_slot, cell);
+    }
+
+    void visit(IR* ir) {
+        switch (ir->type) {
+        case IROptype::assign:
+            update(ir->result_slot, LatticeCell::from_varying());
+            break;
+        case IROptype::inc:
+        case IROptype::dec: {
+            // the operand is written back as well
+            auto &lhs = static_cast<IRUnary*>(ir)->lhs;
+            if (lhs.type == IROpearndType::temp) {
+                update(lhs.get_slot(), LatticeCell::from_varying());
+            }
+            update(ir->result_slot, LatticeCell::from_varying());
+            break;
+        }
+        case IROptype::typecast: {
+            auto cast = static_cast<IRCast*>(ir);
+            auto value = cell_of(cast->value);
+            if (value.state == LatticeCell::constant) {
+                update(ir->result_slot, LatticeCell::from_constant(cast->kernel(value.value)));
+            } else if (value.state == LatticeCell::varying) {
+                update(ir->result_slot, value);
+            }
+            break;
+        }
+        case IROptype::call:
+        case IROptype::printf_func:
+        case IROptype::array_index:
+        case IROptype::load:
+        case IROptype::store:
+            update(ir->result_slot, LatticeCell::from_varying());
+            break;
+        default: {
+            auto binary = static_cast<IRBinary*>(ir);
+            auto lhs = cell_of(binary->lhs), rhs = cell_of(binary->rhs);
+            if (lhs.state == LatticeCell::varying || rhs.state == LatticeCell::varying || traps(binary, rhs)) {
+                update(ir->result_slot, LatticeCell::from_varying());
+            } else if (lhs.state == LatticeCell::constant && rhs.state == LatticeCell::constant) {
+                update(ir->result_slot, LatticeCell::from_constant(binary->kernel(lhs.value, rhs.value)));
+            }
+            break;
+        }
+        }
+    }
+
+    // integer division by 0 or -1 may trap, it is left for run time
+    bool traps(IRBinary* binary, const LatticeCell &rhs) {
+        if (binary->type != IROptype::divide || rhs.state != LatticeCell::constant) {
+            return false;
+        }
+        if (binary->kind == IRKind::f32 || binary->kind == IRKind::f64) {
+            return false;
+        }
+        auto divisor = static_cast<int64_t>(rhs.value.i);
+        return divisor == 0 || divisor == -1;
+    }
+
+    void visit_jump(int bid) {
+        auto &jump = func.body[static_cast<size_t>(bid)]->jump;
+        if (jump.jump_type == IRJump::direct) {
+            flow_worklist.push_back({ bid, jump.targets()[0] });
+        } else if (jump.jump_type == IRJump::cond) {
+            auto &cond_jump = std::get<IRJump::CondJump>(jump.jump);
+            auto cond = cell_of(cond_jump.cond_value);
+            if (cond.state == LatticeCell::constant) {
+                flow_worklist.push_back({ bid, cond.value.is_true() ? cond_jump.true_bid : cond_jump.false_bid });
+            } else if (cond.state == LatticeCell::varying) {
+                flow_worklist.push_back({ bid, cond_jump.true_bid });
+                flow_worklist.push_back({ bid, cond_jump.false_bid });
+            }
+        } else if (jump.jump_type == IRJump::multiway) {
+            auto &switch_jump = std::get<IRJump::SwitchJump>(jump.jump);
+            auto value = cell_of(switch_jump.value);
+            if (value.state == LatticeCell::constant) {
+                flow_worklist.push_back({ bid, switch_jump.target_of(static_cast<int64_t>(value.value.i)) });
+            } else if (value.state == LatticeCell::varying) {
+                for (int target : jump.targets()) {
+                    flow_worklist.push_back({ bid, target });
+                }
+            }
+        }
+    }
+
+    bool is_constant(int slot) {
+        return slot >= 0 && cells[static_cast<size_t>(slot)].state == LatticeCell::constant;
+    }
+
+    void replace(IRValue &value) {
+        if (value.type == IROpearndType::temp && is_constant(value.get_slot())) {
+            value = func.add_constant(value.value_type, cells[static_cast<size_t>(value.get_slot())].value);
+        }
+    }
+
+    // Constant temps become pool constants and their pure definitions go
+    // away. Branches and switches on constants become jumps, and blocks never reached
+    // are emptied, to be removed by a later pass.
+    void rewrite() {
+        for (size_t bid = 0; bid < func.body.size(); bid++) {
+            auto block = func.body[bid];
+            if (!visited[bid]) {
+                block->statements.clear();
+                block->jump = IRJump();
+                continue;
+            }
+            std::vector<IR*> statements;
+            for (auto ir : block->statements) {
+                if (!has_side_effects(ir->type) && is_constant(ir->result_slot)) {
+                    continue;
+                }
+                if (ir->type == IROptype::phi) {
+                    auto &incoming = static_cast<IRPhi*>(ir)->incoming;
+                    std::vector<std::pair<int, IRValue>> live;
+                    for (auto &edge : incoming) {
+                        if (executable.count({ edge.first, static_cast<int>(bid) })) {
+                            live.push_back(edge);
+                        }
+                    }
+                    incoming = live;
+                }
+                ir->visit_operands([&](IRValue &value) { replace(value); });
+                statements.push_back(ir);
+            }
+            block->statements = std::move(statements);
+
+            auto &jump = block->jump;
+            if (jump.jump_type == IRJump::cond) {
+                auto &cond_jump = std::get<IRJump::CondJump>(jump.jump);
+                auto cond = cell_of(cond_jump.cond_value);
+                if (cond.state == LatticeCell::constant) {
+                    jump = IRJump::from_direct_jump(cond.value.is_true() ? cond_jump.true_bid : cond_jump.false_bid);
+                    continue;
+                }
+            } else if (jump.jump_type == IRJump::multiway) {
+                auto &switch_jump = std::get<IRJump::SwitchJump>(jump.jump);
+                auto value = cell_of(switch_jump.value);
+                if (value.state == LatticeCell::constant) {
+                    jump = IRJump::from_direct_jump(switch_jump.target_of(static_cast<int64_t>(value.value.i)));
+                    continue;
+                }
+            }
+            if (auto value = jump.operand()) {
+                replace(*value);
+            }
+        }
+    }
+};
+
+}
+
+void propagate_constants(IRFunction &func) {
+    ConstantPropagation(func).run();
+}
@@ -1,156 +1,159 @@
-%{
-#include <iostream>
-#include <cstdio>
+%require "3.2"
+%language "c++"
+%define api.value.type variant
+%define api.location.file none
+%locations
+
+%code requires {
+#include <string_view>
 #include <vector>
-#include <string>
 #include "node.hpp"
 
-std::vector<std::shared_ptr<NFunction>> programBlocks; /* the top level root node of our final AST */
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+}
 
-extern "C" int yylex(void);
-// char yytext[];
-extern int column;
+%parse-param { yyscan_t scanner } { TranslationUnit &unit }
+%lex-param { yyscan_t scanner }
 
-void yyerror(const char* s)
-{
-    fflush(stdout);
-    printf("\n%*s\n%*s\n", column, "^", column, s);
-}
-%}
-%union {
-    Node *node;
-    NBlock *block;
-    NExpression *expr;
-    NStatement *stmt;
-    NIdentifier *ident;
-    NFunctionDeclaration *func_decl;
-	NFunction *func;
-    NVariableDeclaration *var_decl;
-    NVariableDeclarationList *var_list;
-    ExpressionList *expr_list;
-    std::string *string;
-    int token;
-    int pointer_level;
+%code {
+#include <iostream>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+int yylex(yy::parser::value_type* yylval, yy::parser::location_type* yylloc, yyscan_t yyscanner);
+
+#define LOCATE(node, loc) ((node)->location = SourceLocation { (loc).begin.line, (loc).begin.column })
 }
 
-%token <string> IDENTIFIER CONSTANT STRING_LITERAL SIZEOF
-%token <token> PTR_OP INC_OP DEC_OP LEFT_OP RIGHT_OP LE_OP GE_OP EQ_OP NE_OP
-%token <token> AND_OP OR_OP MUL_ASSIGN DIV_ASSIGN MOD_ASSIGN ADD_ASSIGN
-%token <token> SUB_ASSIGN LEFT_ASSIGN RIGHT_ASSIGN AND_ASSIGN
-%token <token> XOR_ASSIGN OR_ASSIGN TYPE_NAME
-%token <token> NEG_OP ADD_OP MUL_OP DIV_OP MOD_OP LT_OP GT_OP
-%token <token> CHAR SHORT INT LONG SIGNED UNSIGNED FLOAT DOUBLE VOID
+%token <Symbol> IDENTIFIER
+%token <std::string_view> CONSTANT STRING_LITERAL
+%token <int> SIZEOF
+%token <int> PTR_OP INC_OP DEC_OP LEFT_OP RIGHT_OP LE_OP GE_OP EQ_OP NE_OP
+%token <int> AND_OP OR_OP MUL_ASSIGN DIV_ASSIGN MOD_ASSIGN ADD_ASSIGN
+%token <int> SUB_ASSIGN LEFT_ASSIGN RIGHT_ASSIGN AND_ASSIGN
+%token <int> XOR_ASSIGN OR_ASSIGN TYPE_NAME
+%token <int> NEG_OP ADD_OP MUL_OP DIV_OP MOD_OP LT_OP GT_OP
+%token <int> CHAR SHORT INT LONG SIGNED UNSIGNED FLOAT DOUBLE VOID
 
 %token CASE DEFAULT IF ELSE SWITCH WHILE DO FOR GOTO CONTINUE BREAK RETURN
 
-%type <expr> expression assignment_expression conditional_expression  postfix_expression
-%type <expr> primary_expression  equality_expression
-%type <expr> additive_expression multiplicative_expression 
-%type <expr> shift_expression relational_expression and_expression 
-%type <expr> inclusive_or_expression exclusive_or_expression
-%type <expr> logical_and_expression logical_or_expression unary_expression cast_expression
-%type <expr_list> argument_expression_list
-%type <var_decl> parameter_declaration init_declarator
+%type <NExpression*> expression assignment_expression conditional_expression  postfix_expression
+%type <NExpression*> primary_expression  equality_expression
+%type <NExpression*> additive_expression multiplicative_expression 
+%type <NExpression*> shift_expression relational_expression and_expression 
+%type <NExpression*> inclusive_or_expression exclusive_or_expression
+%type <NExpression*> logical_and_expression logical_or_expression unary_expression cast_expression
+%type <NExpression*> constant_expression
+%type <ExpressionList> argument_expression_list
+%type <NVariableDeclaration*> parameter_declaration init_declarator
 /* %type <var_decl> parameter_declaration */
-%type <ident> declarator   direct_declarator
-%type <var_list> parameter_list declaration init_declarator_list
-// %type <exprvec> 
-%type <func> translation_unit function_definition
-%type <func_decl> func_declarator
-%type <stmt> statement declaration_statement expression_statement selection_statement iteration_statement jump_statement
-%type <token> type_specifier
-%type <pointer_level> pointer
-%type <block> statement_list compound_statement
+%type <NIdentifier*> declarator   direct_declarator
+%type <NVariableDeclarationList*> parameter_list declaration init_declarator_list
+%type <NFunction*> function_definition
+%type <NFunctionDeclaration*> func_declarator
+%type <NStatement*> statement declaration_statement expression_statement selection_statement iteration_statement jump_statement
+%type <int> type_specifier
+%type <int> pointer
+%type <NBlock*> statement_list compound_statement
+%type <NSwitchStatement*> switch_clause_list
+%type <NCaseClause*> switch_clause
 
 %start translation_unit
 %%
 
 primary_expression
 	: IDENTIFIER {
-		$$ = new NIdentifier(std::shared_ptr<std::string>($1));
+		$$ = unit.arena.make<NIdentifier>($1);
+		LOCATE($$, @1);
 	}
 	| CONSTANT {
-        $$ = new NInteger(std::stoll(*$1));
-		delete $1;
+        $$ = unit.arena.make<NInteger>(parse_integer($1));
+		LOCATE($$, @1);
 	}
     | '(' expression ')' {
         $$ = $2;
     }
 	| STRING_LITERAL {
-        $$ = new NStringLiteral(
-            std::shared_ptr<std::string>($1)
-        );
+        $$ = unit.arena.make<NStringLiteral>(std::string($1));
+        LOCATE($$, @1);
     }
 	;
 
 postfix_expression
-	: primary_expression
+	: primary_expression { $$ = $1; }
 	| postfix_expression '[' expression ']' {
-        $$ = new NArrayIndex(
-            std::shared_ptr<NExpression>($1),
-            std::shared_ptr<NExpression>($3)
+        $$ = unit.arena.make<NArrayIndex>(
+            $1,
+            $3
         );
+        LOCATE($$, @2);
     }
 	| IDENTIFIER '(' ')' {
-        $$ = new NMethodCall(
-            std::make_shared<NIdentifier>(
-                std::shared_ptr<std::string>($1)
-            ) 
+        $$ = unit.arena.make<NMethodCall>(
+            unit.arena.make<NIdentifier>($1)
         );
+        LOCATE($$, @1);
     }
 	| IDENTIFIER '(' argument_expression_list ')' {
-        $$ = new NMethodCall(
-            std::make_shared<NIdentifier>(
-                std::shared_ptr<std::string>($1)
-            ),
-            std::shared_ptr<ExpressionList>($3)
+        $$ = unit.arena.make<NMethodCall>(
+            unit.arena.make<NIdentifier>($1),
+            std::move($3)
         );
+        LOCATE($$, @1);
     }
     /*
 	| postfix_expression '.' IDENTIFIER
 	| postfix_expression PTR_OP IDENTIFIER
     */
 	| postfix_expression INC_OP {
-        $$ = new NUnaryOperator(
-            std::shared_ptr<NExpression>($1),
+        $$ = unit.arena.make<NUnaryOperator>(
+            $1,
             $2
         );
+        LOCATE($$, @2);
     }
 	| postfix_expression DEC_OP {
-        $$ = new NUnaryOperator(
-            std::shared_ptr<NExpression>($1),
+        $$ = unit.arena.make<NUnaryOperator>(
+            $1,
             $2
         );
+        LOCATE($$, @2);
     }
 	;
 
 argument_expression_list
 	: assignment_expression {
-		$$ = new ExpressionList();
-		$$->push_back(std::shared_ptr<NExpression>($1));
+		$$.push_back($1);
     }
 	| argument_expression_list ',' assignment_expression {
-		$1->push_back(std::shared_ptr<NExpression>($3));
+		$$ = std::move($1);
+		$$.push_back($3);
     }
 	;
 
 unary_expression
-	: postfix_expression
+	: postfix_expression { $$ = $1; }
 	| INC_OP unary_expression {
-        $$ = new NUnaryOperator(
-            std::shared_ptr<NExpression>($2),
+        $$ = unit.arena.make<NUnaryOperator>(
+            $2,
             $1
         );
+        LOCATE($$, @1);
     }
 	| DEC_OP unary_expression {
-        $$ = new NUnaryOperator(
-            std::shared_ptr<NExpression>($2),
+        $$ = unit.arena.make<NUnaryOperator>(
+            $2,
             $1
         );
+        LOCATE($$, @1);
     }
 	/* | unary_operator cast_expression {
-        $$ = new NUnaryOperator(
-            std::shared_ptr<NExpression>($2),
+        $$ = unit.arena.make<NUnaryOperator>(
+            $2,
             $1
         );
     } */
@@ -169,130 +172,124 @@ unary_expression
 	; */
 
 cast_expression
-	: unary_expression
+	: unary_expression { $$ = $1; }
 	/* | '(' type_name ')' cast_expression */
 	;
 
 multiplicative_expression
 	: multiplicative_expression MUL_OP cast_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	| multiplicative_expression DIV_OP cast_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	| multiplicative_expression MOD_OP cast_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
-	| cast_expression
+	| cast_expression { $$ = $1; }
 	;
 
 additive_expression
-	: multiplicative_expression
+	: multiplicative_expression { $$ = $1; }
 	| additive_expression ADD_OP multiplicative_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	| additive_expression NEG_OP multiplicative_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	;
 
 shift_expression
-	: additive_expression
+	: additive_expression { $$ = $1; }
 	| shift_expression LEFT_OP additive_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	| shift_expression RIGHT_OP additive_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	;
 
 relational_expression
-	: shift_expression
+	: shift_expression { $$ = $1; }
 	| relational_expression LT_OP shift_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	| relational_expression GT_OP shift_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	| relational_expression LE_OP shift_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	| relational_expression GE_OP shift_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	;
 
 equality_expression
-	: relational_expression
+	: relational_expression { $$ = $1; }
 	| equality_expression EQ_OP relational_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	| equality_expression NE_OP relational_expression {
-		$$ = new NBinaryOperator(std::shared_ptr<NExpression>($1),
-			$2,
-			std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NBinaryOperator>($1, $2, $3);
+		LOCATE($$, @2);
 	}
 	;
 
 and_expression
-	: equality_expression
+	: equality_expression { $$ = $1; }
 	/* | and_expression '&' equality_expression */
 	;
 
 exclusive_or_expression
-	: and_expression
+	: and_expression { $$ = $1; }
 	/* | exclusive_or_expression '^' and_expression */
 	;
 
 inclusive_or_expression
-	: exclusive_or_expression
+	: exclusive_or_expression { $$ = $1; }
 	/* | inclusive_or_expression '|' exclusive_or_expression */
 	;
 
 logical_and_expression
-	: inclusive_or_expression
-	/* | logical_and_expression AND_OP inclusive_or_expression */
+	: inclusive_or_expression { $$ = $1; }
+	| logical_and_expression AND_OP inclusive_or_expression {
+		$$ = unit.arena.make<NLogicalOperator>($1, $2, $3);
+		LOCATE($$, @2);
+	}
 	;
 
 logical_or_expression
-	: logical_and_expression
-	/* | logical_or_expression OR_OP logical_and_expression */
+	: logical_and_expression { $$ = $1; }
+	| logical_or_expression OR_OP logical_and_expression {
+		$$ = unit.arena.make<NLogicalOperator>($1, $2, $3);
+		LOCATE($$, @2);
+	}
 	;
 
 conditional_expression
-	: logical_or_expression
+	: logical_or_expression { $$ = $1; }
 	/* | logical_or_expression '?' expression ':' conditional_expression */
 	;
 
 assignment_expression
 	: unary_expression assignment_operator assignment_expression {
-		$$ = new NAssignment(std::shared_ptr<NExpression>($1), std::shared_ptr<NExpression>($3));
+		$$ = unit.arena.make<NAssignment>($1, $3);
+		LOCATE($$, @2);
 	}
-	| conditional_expression
+	| conditional_expression { $$ = $1; }
 	;
 
 assignment_operator
@@ -310,12 +307,12 @@ assignment_operator
 	;
 
 expression
-	: assignment_expression
+	: assignment_expression { $$ = $1; }
 	/* | expression ',' assignment_expression */
 	;
 
 constant_expression
-	: conditional_expression
+	: conditional_expression { $$ = $1; }
 	;
 
 declaration
@@ -327,54 +324,55 @@ declaration
 
 init_declarator_list
 	: init_declarator {
-		$$ = new NVariableDeclarationList(std::make_shared<VariableList>());
-		$$->push_back(std::shared_ptr<NVariableDeclaration>($1));
+		$$ = unit.arena.make<NVariableDeclarationList>();
+		$$->push_back($1);
 	}
 	| init_declarator_list ',' init_declarator {
-		$1->push_back(std::shared_ptr<NVariableDeclaration>($3));
+		$$ = $1;
+		$$->push_back($3);
 	};
 	;
 
 init_declarator
 	: declarator '=' conditional_expression {
-		$$ = new NVariableDeclaration(
+		$$ = unit.arena.make<NVariableDeclaration>(
 			0,
-			std::shared_ptr<NIdentifier>($1),
-			std::shared_ptr<NExpression>($3)
+			$1,
+			$3
 		); 
 	}
 	| declarator {
-		$$ = new NVariableDeclaration(
+		$$ = unit.arena.make<NVariableDeclaration>(
 			0,
-			std::shared_ptr<NIdentifier>($1)
+			$1
 		); 
 	}
 	;
 
 type_specifier
-	: VOID
-	| CHAR
-	| SHORT
-	| INT
-	| LONG
-	| FLOAT
-	| DOUBLE
-	| SIGNED
-	| UNSIGNED
-	| TYPE_NAME
+	: VOID { $$ = $1; }
+	| CHAR { $$ = $1; }
+	| SHORT { $$ = $1; }
+	| INT { $$ = $1; }
+	| LONG { $$ = $1; }
+	| FLOAT { $$ = $1; }
+	| DOUBLE { $$ = $1; }
+	| SIGNED { $$ = $1; }
+	| UNSIGNED { $$ = $1; }
+	| TYPE_NAME { $$ = $1; }
 	;
 
 declarator
 	: pointer direct_declarator { $2->pointer_level = 1; $$ = $2; }
-	| direct_declarator
+	| direct_declarator { $$ = $1; }
 	;
 
 direct_declarator
-	: IDENTIFIER { $$ = new NIdentifier(std::shared_ptr<std::string>($1)); }
+	: IDENTIFIER { $$ = unit.arena.make<NIdentifier>($1); LOCATE($$, @1); }
 	/* | '(' declarator ')' */
 	| direct_declarator '[' CONSTANT ']' {
-        $1->array_size = std::stoi(*$3);
-        delete $3;
+        $1->array_size = static_cast<int>(parse_integer($3));
+        $$ = $1;
 	}
 	/* | direct_declarator '[' ']' */
 	;
@@ -386,11 +384,9 @@ pointer
 
 func_declarator
 	: IDENTIFIER '(' parameter_list ')' {
-		$$ = new NFunctionDeclaration(
-			std::make_shared<NIdentifier>(
-				std::shared_ptr<std::string>($1)
-			),
-			std::shared_ptr<NVariableDeclarationList>($3)
+		$$ = unit.arena.make<NFunctionDeclaration>(
+			unit.arena.make<NIdentifier>($1),
+			$3
 		);
 	}
 	// | IDENTIFIER '(' identifier_list ')'
@@ -399,19 +395,20 @@ func_declarator
 
 parameter_list
 	: parameter_declaration {
-		$$ = new NVariableDeclarationList(std::make_shared<VariableList>());
-		$$->push_back(std::shared_ptr<NVariableDeclaration>($1));
+		$$ = unit.arena.make<NVariableDeclarationList>();
+		$$->push_back($1);
 	}
 	| parameter_list ',' parameter_declaration {
-		$1->push_back(std::shared_ptr<NVariableDeclaration>($3));
+		$$ = $1;
+		$$->push_back($3);
 	};
 
 parameter_declaration
 	: type_specifier {
-        $$ = new NVariableDeclaration($1, std::shared_ptr<NIdentifier>(nullptr));
+        $$ = unit.arena.make<NVariableDeclaration>($1, nullptr);
     }
 	| type_specifier declarator {
-        $$ = new NVariableDeclaration($1, std::shared_ptr<NIdentifier>($2));
+        $$ = unit.arena.make<NVariableDeclaration>($1, $2);
     }
 	;
 
@@ -422,94 +419,156 @@ identifier_list
 
 declaration_statement
     : declaration ';' {
-			$$ = $<stmt>1;
+			$$ = $1;
 		}
     ;
 
 expression_statement
-	: expression ';' { $$ = new NExpressionStatement(std::shared_ptr<NExpression>($1)); }
-	/* | ';' { $$ = new NExpressionStatement(std::shared_ptr<NExpression>(nullptr)); } */
+	: expression ';' { $$ = unit.arena.make<NExpressionStatement>($1); LOCATE($$, @1); }
+	/* | ';' { $$ = unit.arena.make<NExpressionStatement>(nullptr); } */
 	;
 
 selection_statement
 	: IF '(' expression ')' compound_statement {
-        $$ = new NIfStatement(
-            std::shared_ptr<NExpression>($3),
-            std::shared_ptr<NBlock>($5)
+        $$ = unit.arena.make<NIfStatement>(
+            $3,
+            $5
         );
+        LOCATE($$, @1);
     }
 	/* | IF '(' expression ')' compound_statement ELSE compound_statement {
 
     } */
+	| SWITCH '(' expression ')' '{' switch_clause_list '}' {
+        $6->condition = $3;
+        $$ = $6;
+        LOCATE($$, @1);
+    }
+	;
+
+switch_clause_list
+	: switch_clause {
+        $$ = unit.arena.make<NSwitchStatement>();
+        $$->push_back($1);
+    }
+	| switch_clause_list switch_clause {
+        $$ = $1;
+        $$->push_back($2);
+    }
+	;
+
+switch_clause
+	: CASE constant_expression ':' {
+        $$ = unit.arena.make<NCaseClause>($2, unit.arena.make<NBlock>());
+        LOCATE($$, @1);
+    }
+	| CASE constant_expression ':' statement_list {
+        $$ = unit.arena.make<NCaseClause>($2, $4);
+        LOCATE($$, @1);
+    }
+	| DEFAULT ':' {
+        $$ = unit.arena.make<NCaseClause>(nullptr, unit.arena.make<NBlock>());
+        LOCATE($$, @1);
+    }
+	| DEFAULT ':' statement_list {
+        $$ = unit.arena.make<NCaseClause>(nullptr, $3);
+        LOCATE($$, @1);
+    }
 	;
 
 iteration_statement
 	: FOR '(' expression ';' expression ';' ')' compound_statement {
-        $$ = new NForStatement(
-            std::shared_ptr<NBlock>($8),
-            std::shared_ptr<NExpression>($3),
-            std::shared_ptr<NExpression>($5)
+        $$ = unit.arena.make<NForStatement>(
+            $8,
+            $3,
+            $5
         );
+        LOCATE($$, @1);
     }
 	| FOR '(' expression ';' expression ';' expression ')' compound_statement {
-        $$ = new NForStatement(
-            std::shared_ptr<NBlock>($9),
-            std::shared_ptr<NExpression>($3),
-            std::shared_ptr<NExpression>($5),
-            std::shared_ptr<NExpression>($7)
+        $$ = unit.arena.make<NForStatement>(
+            $9,
+            $3,
+            $5,
+            $7
         );
+        LOCATE($$, @1);
+    }
+	| WHILE '(' expression ')' compound_statement {
+        $$ = unit.arena.make<NWhileStatement>(
+            $3,
+            $5
+        );
+        LOCATE($$, @1);
+    }
+	| DO compound_statement WHILE '(' expression ')' ';' {
+        $$ = unit.arena.make<NWhileStatement>(
+            $5,
+            $2,
+            false
+        );
+        LOCATE($$, @1);
     }
-	/* | WHILE '(' expression ')' statement
-	| DO statement WHILE '(' expression ')' ';' */
 	;
 
 jump_statement
 	: RETURN expression ';' {
-        $$ = new NReturnStatement(
-            std::shared_ptr<NExpression>($2)
+        $$ = unit.arena.make<NReturnStatement>(
+            $2
         );
+        LOCATE($$, @1);
     }
 	/* | RETURN ';' */
+	| BREAK ';' {
+        $$ = unit.arena.make<NBreakStatement>();
+        LOCATE($$, @1);
+    }
 	/* | GOTO IDENTIFIER ';'
-	| CONTINUE ';'
-	| BREAK ';' */
+	| CONTINUE ';' */
 	;
 
 statement
-	: declaration_statement
-	| expression_statement
-	| selection_statement
-	| iteration_statement
-	| jump_statement
+	: declaration_statement { $$ = $1; }
+	| expression_statement { $$ = $1; }
+	| selection_statement { $$ = $1; }
+	| iteration_statement { $$ = $1; }
+	| jump_statement { $$ = $1; }
 	;
 
 statement_list
 	: statement {
-        $$ = new NBlock();
-        $$->push_back(std::shared_ptr<NStatement>($1));
+        $$ = unit.arena.make<NBlock>();
+        $$->push_back($1);
     }
 	| statement_list statement {
-        $1->push_back(std::shared_ptr<NStatement>($2));
+        $$ = $1;
+        $$->push_back($2);
     }
 	;
 
 compound_statement
-	: '{' '}' { $$ = new NBlock(); }
+	: '{' '}' { $$ = unit.arena.make<NBlock>(); }
 	| '{' statement_list '}' { $$ = $2; }
 	;
 
 
 
 translation_unit
-	: function_definition { programBlocks.push_back(std::shared_ptr<NFunction>($1)); }
-	| translation_unit function_definition { programBlocks.push_back(std::shared_ptr<NFunction>($2)); }
+	: function_definition { unit.functions.push_back($1); }
+	| translation_unit function_definition { unit.functions.push_back($2); }
 	;
 
 function_definition
 	: type_specifier func_declarator compound_statement {
-        $$ = new NFunction($1,
-        std::shared_ptr<NFunctionDeclaration>($2),
-        std::shared_ptr<NBlock>($3));
+        $$ = unit.arena.make<NFunction>($1,
+        $2,
+        $3);
+        LOCATE($$, @2);
     }
 	;
 %%
+
+void yy::parser::error(const location_type& loc, const std::string& msg)
+{
+    throw std::runtime_error(std::to_string(loc.begin.line) + ":" + std::to_string(loc.begin.column) + ": " + msg);
+}
@@ -1,2269 +1,2861 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+// A Bison parser, made by GNU Bison 3.8.2.
 
-/* Bison implementation for Yacc-like parsers in C
+// Skeleton implementation for Bison LALR(1) parsers in C++
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
-   Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
-   This program is free software: you can redistribute it and/or modify
-   it under the terms of the GNU General Public License as published by
-   the Free Software Foundation, either version 3 of the License, or
-   (at your option) any later version.
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
 
-   This program is distributed in the hope that it will be useful,
-   but WITHOUT ANY WARRANTY; without even the implied warranty of
-   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-   GNU General Public License for more details.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
 
-   You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
-/* As a special exception, you may create a larger work that contains
-   part or all of the Bison parser skeleton and distribute that work
-   under terms of your choice, so long as that work isn't itself a
-   parser generator using the skeleton or a modified version thereof
-   as a parser skeleton.  Alternatively, if you modify or redistribute
-   the parser skeleton itself, you may (at your option) remove this
-   special exception, which will cause the skeleton and the resulting
-   Bison output files to be licensed under the GNU General Public
-   License without this special exception.
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
 
-   This special exception was added by the Free Software Foundation in
-   version 2.2 of Bison.  */
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
 
-/* C LALR(1) parser skeleton written by Richard Stallman, by
-   simplifying the original so-called "semantic" parser.  */
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
-/* All symbols defined below should begin with yy or YY, to avoid
-   infringing on user name space.  This should be done even for local
-   variables, as they might otherwise be expanded by user macros.
-   There are some unavoidable exceptions within include files to
-   define necessary library symbols; they are noted "INFRINGES ON
-   USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.5.1"
 
-/* Skeleton name.  */
-#define YYSKELETON_NAME "yacc.c"
+#include "semic_grammar.hpp"
 
-/* Pure parsers.  */
-#define YYPURE 0
 
-/* Push parsers.  */
-#define YYPUSH 0
-
-/* Pull parsers.  */
-#define YYPULL 1
-
-
-
-
-/* First part of user prologue.  */
-#line 1 "semic.y"
+// Unqualified %code blocks.
+#line 21 "semic.y"
 
 #include <iostream>
 #include <cstdio>
-#include <vector>
+#include <stdexcept>
 #include <string>
-#include "node.hpp"
-
-std::vector<std::shared_ptr<NFunction>> programBlocks; /* the top level root node of our final AST */
-
-extern "C" int yylex(void);
-// char yytext[];
-extern int column;
-
-void yyerror(const char* s)
-{
-    fflush(stdout);
-    printf("\n%*s\n%*s\n", column, "^", column, s);
-}
-
-#line 90 "semic_grammar.cpp"
-
-# ifndef YY_CAST
-#  ifdef __cplusplus
-#   define YY_CAST(Type, Val) static_cast<Type> (Val)
-#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
-#  else
-#   define YY_CAST(Type, Val) ((Type) (Val))
-#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
-#  endif
-# endif
-# ifndef YY_NULLPTR
-#  if defined __cplusplus
-#   if 201103L <= __cplusplus
-#    define YY_NULLPTR nullptr
-#   else
-#    define YY_NULLPTR 0
-#   endif
-#  else
-#   define YY_NULLPTR ((void*)0)
-#  endif
-# endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Use api.header.include to #include this header
-   instead of duplicating it here.  */
-#ifndef YY_YY_SEMIC_GRAMMAR_HPP_INCLUDED
-# define YY_YY_SEMIC_GRAMMAR_HPP_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    IDENTIFIER = 258,
-    CONSTANT = 259,
-    STRING_LITERAL = 260,
-    SIZEOF = 261,
-    PTR_OP = 262,
-    INC_OP = 263,
-    DEC_OP = 264,
-    LEFT_OP = 265,
-    RIGHT_OP = 266,
-    LE_OP = 267,
-    GE_OP = 268,
-    EQ_OP = 269,
-    NE_OP = 270,
-    AND_OP = 271,
-    OR_OP = 272,
-    MUL_ASSIGN = 273,
-    DIV_ASSIGN = 274,
-    MOD_ASSIGN = 275,
-    ADD_ASSIGN = 276,
-    SUB_ASSIGN = 277,
-    LEFT_ASSIGN = 278,
-    RIGHT_ASSIGN = 279,
-    AND_ASSIGN = 280,
-    XOR_ASSIGN = 281,
-    OR_ASSIGN = 282,
-    TYPE_NAME = 283,
-    NEG_OP = 284,
-    ADD_OP = 285,
-    MUL_OP = 286,
-    DIV_OP = 287,
-    MOD_OP = 288,
-    LT_OP = 289,
-    GT_OP = 290,
-    CHAR = 291,
-    SHORT = 292,
-    INT = 293,
-    LONG = 294,
-    SIGNED = 295,
-    UNSIGNED = 296,
-    FLOAT = 297,
-    DOUBLE = 298,
-    VOID = 299,
-    CASE = 300,
-    DEFAULT = 301,
-    IF = 302,
-    ELSE = 303,
-    SWITCH = 304,
-    WHILE = 305,
-    DO = 306,
-    FOR = 307,
-    GOTO = 308,
-    CONTINUE = 309,
-    BREAK = 310,
-    RETURN = 311
-  };
-#endif
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-union YYSTYPE
-{
-#line 20 "semic.y"
-
-    Node *node;
-    NBlock *block;
-    NExpression *expr;
-    NStatement *stmt;
-    NIdentifier *ident;
-    NFunctionDeclaration *func_decl;
-	NFunction *func;
-    NVariableDeclaration *var_decl;
-    NVariableDeclarationList *var_list;
-    ExpressionList *expr_list;
-    std::string *string;
-    int token;
-    int pointer_level;
-
-#line 215 "semic_grammar.cpp"
-
-};
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
-
-
-extern YYSTYPE yylval;
-
-int yyparse (void);
-
-#endif /* !YY_YY_SEMIC_GRAMMAR_HPP_INCLUDED  */
-
-
-
-#ifdef short
-# undef short
-#endif
-
-/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
-   <limits.h> and (if available) <stdint.h> are included
-   so that the code can choose integer types of a good width.  */
-
-#ifndef __PTRDIFF_MAX__
-# include <limits.h> /* INFRINGES ON USER NAME SPACE */
-# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
-#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
-#  define YY_STDINT_H
-# endif
-#endif
-
-/* Narrow types that promote to a signed type and that can represent a
-   signed or unsigned integer of at least N bits.  In tables they can
-   save space and decrease cache pressure.  Promoting to a signed type
-   helps avoid bugs in integer arithmetic.  */
-
-#ifdef __INT_LEAST8_MAX__
-typedef __INT_LEAST8_TYPE__ yytype_int8;
-#elif defined YY_STDINT_H
-typedef int_least8_t yytype_int8;
-#else
-typedef signed char yytype_int8;
-#endif
 
-#ifdef __INT_LEAST16_MAX__
-typedef __INT_LEAST16_TYPE__ yytype_int16;
-#elif defined YY_STDINT_H
-typedef int_least16_t yytype_int16;
-#else
-typedef short yytype_int16;
-#endif
+int yylex(yy::parser::value_type* yylval, yy::parser::location_type* yylloc, yyscan_t yyscanner);
 
-#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
-typedef __UINT_LEAST8_TYPE__ yytype_uint8;
-#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
-       && UINT_LEAST8_MAX <= INT_MAX)
-typedef uint_least8_t yytype_uint8;
-#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
-typedef unsigned char yytype_uint8;
-#else
-typedef short yytype_uint8;
-#endif
+#define LOCATE(node, loc) ((node)->location = SourceLocation { (loc).begin.line, (loc).begin.column })
 
-#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
-typedef __UINT_LEAST16_TYPE__ yytype_uint16;
-#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
-       && UINT_LEAST16_MAX <= INT_MAX)
-typedef uint_least16_t yytype_uint16;
-#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
-typedef unsigned short yytype_uint16;
-#else
-typedef int yytype_uint16;
-#endif
+#line 57 "semic_grammar.cpp"
 
-#ifndef YYPTRDIFF_T
-# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
-#  define YYPTRDIFF_T __PTRDIFF_TYPE__
-#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
-# elif defined PTRDIFF_MAX
-#  ifndef ptrdiff_t
-#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
-#  endif
-#  define YYPTRDIFF_T ptrdiff_t
-#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
-# else
-#  define YYPTRDIFF_T long
-#  define YYPTRDIFF_MAXIMUM LONG_MAX
-# endif
-#endif
-
-#ifndef YYSIZE_T
-# ifdef __SIZE_TYPE__
-#  define YYSIZE_T __SIZE_TYPE__
-# elif defined size_t
-#  define YYSIZE_T size_t
-# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
-#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
-#  define YYSIZE_T size_t
-# else
-#  define YYSIZE_T unsigned
-# endif
-#endif
-
-#define YYSIZE_MAXIMUM                                  \
-  YY_CAST (YYPTRDIFF_T,                                 \
-           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
-            ? YYPTRDIFF_MAXIMUM                         \
-            : YY_CAST (YYSIZE_T, -1)))
-
-#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
-
-/* Stored state numbers (used for stacks). */
-typedef yytype_uint8 yy_state_t;
-
-/* State numbers in computations.  */
-typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
-#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#   include <libintl.h> // FIXME: INFRINGES ON USER NAME SPACE.
+#   define YY_(msgid) dgettext ("bison-runtime", msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(Msgid) Msgid
+#  define YY_(msgid) msgid
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
-#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
 # else
-#  define YY_ATTRIBUTE_PURE
+#  define YY_EXCEPTIONS 1
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_UNUSED
-# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
-#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
-# else
-#  define YY_ATTRIBUTE_UNUSED
+#define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+# ifndef YYLLOC_DEFAULT
+#  define YYLLOC_DEFAULT(Current, Rhs, N)                               \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).begin  = YYRHSLOC (Rhs, 1).begin;                   \
+          (Current).end    = YYRHSLOC (Rhs, N).end;                     \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
+        }                                                               \
+    while (false)
 # endif
-#endif
 
-/* Suppress unused-variable warnings by "using" E.  */
-#if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
-#else
-# define YYUSE(E) /* empty */
-#endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
-/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
-    _Pragma ("GCC diagnostic push")                                     \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
-    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
-    _Pragma ("GCC diagnostic pop")
-#else
-# define YY_INITIAL_VALUE(Value) Value
-#endif
-#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END
-#endif
-#ifndef YY_INITIAL_VALUE
-# define YY_INITIAL_VALUE(Value) /* Nothing. */
-#endif
+// Enable debugging if requested.
+#if YYDEBUG
 
-#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
-# define YY_IGNORE_USELESS_CAST_BEGIN                          \
-    _Pragma ("GCC diagnostic push")                            \
-    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
-# define YY_IGNORE_USELESS_CAST_END            \
-    _Pragma ("GCC diagnostic pop")
-#endif
-#ifndef YY_IGNORE_USELESS_CAST_BEGIN
-# define YY_IGNORE_USELESS_CAST_BEGIN
-# define YY_IGNORE_USELESS_CAST_END
-#endif
+// A pseudo ostream that takes yydebug_ into account.
+# define YYCDEBUG if (yydebug_) (*yycdebug_)
 
+# define YY_SYMBOL_PRINT(Title, Symbol)         \
+  do {                                          \
+    if (yydebug_)                               \
+    {                                           \
+      *yycdebug_ << Title << ' ';               \
+      yy_print_ (*yycdebug_, Symbol);           \
+      *yycdebug_ << '\n';                       \
+    }                                           \
+  } while (false)
 
-#define YY_ASSERT(E) ((void) (0 && (E)))
-
-#if ! defined yyoverflow || YYERROR_VERBOSE
-
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
-
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
-#     ifndef EXIT_SUCCESS
-#      define EXIT_SUCCESS 0
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
+# define YY_REDUCE_PRINT(Rule)          \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_reduce_print_ (Rule);          \
+  } while (false)
 
-# ifdef YYSTACK_ALLOC
-   /* Pacify GCC's 'empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
-#  ifndef YYSTACK_ALLOC_MAXIMUM
-    /* The OS might guarantee only one guard page at the bottom of the stack,
-       and a page size can be as small as 4096 bytes.  So we cannot safely
-       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
-       to allow for a few compiler-allocated temporary stack slots.  */
-#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
-#  endif
-# else
-#  define YYSTACK_ALLOC YYMALLOC
-#  define YYSTACK_FREE YYFREE
-#  ifndef YYSTACK_ALLOC_MAXIMUM
-#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
-#  endif
-#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
-       && ! ((defined YYMALLOC || defined malloc) \
-             && (defined YYFREE || defined free)))
-#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef EXIT_SUCCESS
-#    define EXIT_SUCCESS 0
-#   endif
-#  endif
-#  ifndef YYMALLOC
-#   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS
-void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
-#   endif
-#  endif
-#  ifndef YYFREE
-#   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS
-void free (void *); /* INFRINGES ON USER NAME SPACE */
-#   endif
-#  endif
-# endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
+# define YY_STACK_PRINT()               \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_stack_print_ ();                \
+  } while (false)
 
+#else // !YYDEBUG
 
-#if (! defined yyoverflow \
-     && (! defined __cplusplus \
-         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+# define YYCDEBUG if (false) std::cerr
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
-/* A type that is properly aligned for any stack member.  */
-union yyalloc
-{
-  yy_state_t yyss_alloc;
-  YYSTYPE yyvs_alloc;
-};
-
-/* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
-
-/* The size of an array large to enough to hold all stacks, each with
-   N elements.  */
-# define YYSTACK_BYTES(N) \
-     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
-      + YYSTACK_GAP_MAXIMUM)
-
-# define YYCOPY_NEEDED 1
-
-/* Relocate STACK from its old location to the new one.  The
-   local variables YYSIZE and YYSTACKSIZE give the old and new number of
-   elements in the stack, and YYPTR gives the new location of the
-   stack.  Advance YYPTR to a properly aligned location for the next
-   stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
-    do                                                                  \
-      {                                                                 \
-        YYPTRDIFF_T yynewbytes;                                         \
-        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
-        Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
-      }                                                                 \
-    while (0)
+#endif // !YYDEBUG
 
-#endif
+#define yyerrok         (yyerrstatus_ = 0)
+#define yyclearin       (yyla.clear ())
 
-#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from SRC to DST.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
-#  else
-#   define YYCOPY(Dst, Src, Count)              \
-      do                                        \
-        {                                       \
-          YYPTRDIFF_T yyi;                      \
-          for (yyi = 0; yyi < (Count); yyi++)   \
-            (Dst)[yyi] = (Src)[yyi];            \
-        }                                       \
-      while (0)
-#  endif
-# endif
-#endif /* !YYCOPY_NEEDED */
-
-/* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  16
-/* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   219
-
-/* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  66
-/* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  40
-/* YYNRULES -- Number of rules.  */
-#define YYNRULES  99
-/* YYNSTATES -- Number of states.  */
-#define YYNSTATES  156
-
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   311
-
-
-/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  (0 <= (YYX) && (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
-
-/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex.  */
-static const yytype_int8 yytranslate[] =
-{
-       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-      57,    58,     2,     2,    61,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,    63,
-       2,    62,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    59,     2,    60,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    64,     2,    65,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56
-};
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYRECOVERING()  (!!yyerrstatus_)
 
-#if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_int16 yyrline[] =
-{
-       0,    69,    69,    72,    76,    79,    87,    88,    94,   101,
-     113,   119,   128,   132,   138,   139,   145,   172,   177,   182,
-     187,   192,   196,   197,   202,   210,   211,   216,   224,   225,
-     230,   235,   240,   248,   249,   254,   262,   267,   272,   277,
-     282,   287,   292,   295,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   313,   322,   329,   333,   339,
-     346,   355,   356,   357,   358,   359,   360,   361,   362,   363,
-     364,   368,   369,   373,   375,   383,   384,   388,   401,   405,
-     410,   413,   424,   430,   435,   447,   454,   467,   479,   480,
-     481,   482,   483,   487,   491,   497,   498,   504,   505,   509
-};
-#endif
+namespace yy {
+#line 149 "semic_grammar.cpp"
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
-/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
-static const char *const yytname[] =
-{
-  "$end", "error", "$undefined", "IDENTIFIER", "CONSTANT",
-  "STRING_LITERAL", "SIZEOF", "PTR_OP", "INC_OP", "DEC_OP", "LEFT_OP",
-  "RIGHT_OP", "LE_OP", "GE_OP", "EQ_OP", "NE_OP", "AND_OP", "OR_OP",
-  "MUL_ASSIGN", "DIV_ASSIGN", "MOD_ASSIGN", "ADD_ASSIGN", "SUB_ASSIGN",
-  "LEFT_ASSIGN", "RIGHT_ASSIGN", "AND_ASSIGN", "XOR_ASSIGN", "OR_ASSIGN",
-  "TYPE_NAME", "NEG_OP", "ADD_OP", "MUL_OP", "DIV_OP", "MOD_OP", "LT_OP",
-  "GT_OP", "CHAR", "SHORT", "INT", "LONG", "SIGNED", "UNSIGNED", "FLOAT",
-  "DOUBLE", "VOID", "CASE", "DEFAULT", "IF", "ELSE", "SWITCH", "WHILE",
-  "DO", "FOR", "GOTO", "CONTINUE", "BREAK", "RETURN", "'('", "')'", "'['",
-  "']'", "','", "'='", "';'", "'{'", "'}'", "$accept",
-  "primary_expression", "postfix_expression", "argument_expression_list",
-  "unary_expression", "cast_expression", "multiplicative_expression",
-  "additive_expression", "shift_expression", "relational_expression",
-  "equality_expression", "and_expression", "exclusive_or_expression",
-  "inclusive_or_expression", "logical_and_expression",
-  "logical_or_expression", "conditional_expression",
-  "assignment_expression", "assignment_operator", "expression",
-  "declaration", "init_declarator_list", "init_declarator",
-  "type_specifier", "declarator", "direct_declarator", "pointer",
-  "func_declarator", "parameter_list", "parameter_declaration",
-  "declaration_statement", "expression_statement", "selection_statement",
-  "iteration_statement", "jump_statement", "statement", "statement_list",
-  "compound_statement", "translation_unit", "function_definition", YY_NULLPTR
-};
+  /// Build a parser object.
+  parser::parser (yyscan_t scanner_yyarg, TranslationUnit &unit_yyarg)
+#if YYDEBUG
+    : yydebug_ (false),
+      yycdebug_ (&std::cerr),
+#else
+    :
 #endif
+      scanner (scanner_yyarg),
+      unit (unit_yyarg)
+  {}
+
+  parser::~parser ()
+  {}
+
+  parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
+
+  /*---------.
+  | symbol.  |
+  `---------*/
+
+  // basic_symbol.
+  template <typename Base>
+  parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
+  {
+    switch (this->kind ())
+    {
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        value.copy< ExpressionList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        value.copy< NBlock* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        value.copy< NCaseClause* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        value.copy< NExpression* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        value.copy< NFunction* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        value.copy< NFunctionDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        value.copy< NIdentifier* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        value.copy< NStatement* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        value.copy< NSwitchStatement* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        value.copy< NVariableDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        value.copy< NVariableDeclarationList* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        value.copy< Symbol > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        value.copy< int > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        value.copy< std::string_view > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
-{
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,    40,    41,    91,
-      93,    44,    61,    59,   123,   125
-};
-# endif
+  }
 
-#define YYPACT_NINF (-71)
 
-#define yypact_value_is_default(Yyn) \
-  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yyn) \
-  0
+  template <typename Base>
+  parser::symbol_kind_type
+  parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
-static const yytype_int16 yypact[] =
-{
-     158,   -71,   -71,   -71,   -71,   -71,   -71,   -71,   -71,   -71,
-     -71,    46,   130,   -71,   -50,   -43,   -71,   -71,   158,    50,
-     -71,     1,   -44,   -71,     3,   -71,   -71,    38,    38,     7,
-      13,    38,    38,   -71,   -71,     2,   157,   -71,     6,   -27,
-      18,    64,    68,   -71,   -71,   -71,   -71,   -71,   -71,   -71,
-      33,    51,     1,   -71,   -71,   -71,   -71,   -71,   -71,   100,
-     -71,    44,   -71,    26,   114,   -71,   158,    15,   -71,   -71,
-      38,    38,    55,    61,   -71,   -71,    38,   -71,   -71,   -71,
-     -71,   -71,   -71,   -71,   -71,   -71,   -71,   -71,    38,    38,
-      38,    38,    38,    38,    38,    38,    38,    38,    38,    38,
-      38,    38,   -71,   -71,    59,   -71,    60,   -71,   -71,   -71,
-     121,    26,   -71,   -71,     4,   -71,    69,    63,   -71,   -71,
-      72,   -71,   -71,   -71,   -71,   -71,     6,     6,   -27,   -27,
-      18,    18,    18,    18,    64,    64,     1,    38,    73,   -71,
-      38,   -43,    38,   -71,   -71,   -71,   -71,   -71,   -71,    66,
-      22,   -43,    76,   -71,   -43,   -71
-};
-
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_int8 yydefact[] =
-{
-       0,    70,    62,    63,    64,    65,    68,    69,    66,    67,
-      61,     0,     0,    97,     0,     0,     1,    98,     0,     0,
-      99,    80,     0,    78,     2,     3,     5,     0,     0,     0,
-       0,     0,     0,    95,     6,    14,    17,    21,    22,    25,
-      28,    33,    36,    37,    38,    39,    40,    41,    43,    55,
-       0,     0,     0,    88,    89,    90,    91,    92,    93,     0,
-      73,    75,    81,    72,     0,    77,     0,     0,    15,    16,
-       0,     0,     0,     0,    10,    11,     0,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    54,    44,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    83,    82,    56,    57,    60,    96,    94,    76,
-       0,    71,    79,     8,     0,    12,     0,     0,    87,     4,
-       0,    42,    17,    18,    19,    20,    24,    23,    26,    27,
-      31,    32,    29,    30,    34,    35,     0,     0,     0,     9,
-       0,     0,     0,     7,    58,    59,    74,    13,    84,     0,
-       0,     0,     0,    85,     0,    86
-};
-
-  /* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
-{
-     -71,   -71,   -71,   -71,   -19,   -23,     8,    16,   -63,    12,
-     -71,   -71,   -71,   -71,   -71,   -71,    -2,   -66,   -71,   -26,
-     -71,   -71,     9,    -3,   125,    84,    88,   -71,   -71,    85,
-     -71,   -71,   -71,   -71,   -71,    91,   -71,   -70,   -71,   141
-};
-
-  /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
-{
-      -1,    34,    35,   114,   122,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    88,    50,
-      51,   104,   105,    11,   106,    63,    64,    15,    22,    23,
-      53,    54,    55,    56,    57,    58,    59,    20,    12,    13
-};
-
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_uint8 yytable[] =
-{
-      36,   115,    92,    93,    60,    72,    73,    18,    68,    69,
-      74,    75,    36,    36,    65,    21,    52,    66,    24,    25,
-      26,    19,   121,    27,    28,    24,    25,    26,    94,    95,
-      27,    28,    61,   130,   131,   132,   133,    89,    90,    91,
-      36,    24,    25,    26,   116,   117,    27,    28,    36,    14,
-     120,    36,    36,    24,    25,    26,    52,    36,    27,    28,
-      67,    76,   139,    21,    70,   140,   123,   124,   125,    36,
-      71,   148,    32,   113,   147,    61,    96,    97,     1,    32,
-     151,   153,   100,   101,   155,   110,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,    32,   102,    29,    98,    99,
-     126,   127,    30,    24,    25,    26,    31,    32,    27,    28,
-     128,   129,   134,   135,   103,    33,   149,    60,   118,   119,
-     136,    36,   137,    36,   152,   138,   142,   141,     1,   150,
-      16,    36,   143,   146,   154,   145,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,   144,    62,    29,   111,   109,
-     108,   112,    30,    17,     0,     0,    31,    32,     1,     0,
-       0,     0,     0,     0,     0,   107,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,    77,    78,    79,    80,    81,
-      82,    83,    84,    85,    86,     0,     1,     0,     0,     0,
-       0,     0,     0,     0,     2,     3,     4,     5,     6,     7,
-       8,     9,    10,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    87
-};
-
-static const yytype_int16 yycheck[] =
-{
-      19,    67,    29,    30,     3,    31,    32,    57,    27,    28,
-       8,     9,    31,    32,    58,    18,    19,    61,     3,     4,
-       5,    64,    88,     8,     9,     3,     4,     5,    10,    11,
-       8,     9,    31,    96,    97,    98,    99,    31,    32,    33,
-      59,     3,     4,     5,    70,    71,     8,     9,    67,     3,
-      76,    70,    71,     3,     4,     5,    59,    76,     8,     9,
-      57,    59,    58,    66,    57,    61,    89,    90,    91,    88,
-      57,   141,    57,    58,   140,    31,    12,    13,    28,    57,
-      58,   151,    14,    15,   154,    59,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    57,    63,    47,    34,    35,
-      92,    93,    52,     3,     4,     5,    56,    57,     8,     9,
-      94,    95,   100,   101,    63,    65,   142,     3,    63,    58,
-      61,   140,    62,   142,   150,     4,    63,    58,    28,    63,
-       0,   150,    60,    60,    58,   137,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,   136,    21,    47,    64,    61,
-      59,    66,    52,    12,    -1,    -1,    56,    57,    28,    -1,
-      -1,    -1,    -1,    -1,    -1,    65,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    -1,    28,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    62
-};
-
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_int8 yystos[] =
-{
-       0,    28,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    89,   104,   105,     3,    93,     0,   105,    57,    64,
-     103,    89,    94,    95,     3,     4,     5,     8,     9,    47,
-      52,    56,    57,    65,    67,    68,    70,    71,    72,    73,
-      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
-      85,    86,    89,    96,    97,    98,    99,   100,   101,   102,
-       3,    31,    90,    91,    92,    58,    61,    57,    70,    70,
-      57,    57,    85,    85,     8,     9,    59,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    62,    84,    31,
-      32,    33,    29,    30,    10,    11,    12,    13,    34,    35,
-      14,    15,    63,    63,    87,    88,    90,    65,   101,    92,
-      59,    91,    95,    58,    69,    83,    85,    85,    63,    58,
-      85,    83,    70,    71,    71,    71,    72,    72,    73,    73,
-      74,    74,    74,    74,    75,    75,    61,    62,     4,    58,
-      61,    58,    63,    60,    88,    82,    60,    83,   103,    85,
-      63,    58,    85,   103,    58,   103
-};
-
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_int8 yyr1[] =
-{
-       0,    66,    67,    67,    67,    67,    68,    68,    68,    68,
-      68,    68,    69,    69,    70,    70,    70,    71,    72,    72,
-      72,    72,    73,    73,    73,    74,    74,    74,    75,    75,
-      75,    75,    75,    76,    76,    76,    77,    78,    79,    80,
-      81,    82,    83,    83,    84,    84,    84,    84,    84,    84,
-      84,    84,    84,    84,    84,    85,    86,    87,    87,    88,
-      88,    89,    89,    89,    89,    89,    89,    89,    89,    89,
-      89,    90,    90,    91,    91,    92,    92,    93,    94,    94,
-      95,    95,    96,    97,    98,    99,    99,   100,   101,   101,
-     101,   101,   101,   102,   102,   103,   103,   104,   104,   105
-};
-
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_int8 yyr2[] =
-{
-       0,     2,     1,     1,     3,     1,     1,     4,     3,     4,
-       2,     2,     1,     3,     1,     2,     2,     1,     3,     3,
-       3,     1,     1,     3,     3,     1,     3,     3,     1,     3,
-       3,     3,     3,     1,     3,     3,     1,     1,     1,     1,
-       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     1,     3,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     2,     1,     1,     4,     1,     2,     4,     1,     3,
-       1,     2,     2,     2,     5,     8,     9,     3,     1,     1,
-       1,     1,     1,     1,     2,     2,     3,     1,     2,     3
-};
 
+  template <typename Base>
+  bool
+  parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
+  {
+    return this->kind () == symbol_kind::S_YYEMPTY;
+  }
 
-#define yyerrok         (yyerrstatus = 0)
-#define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
+  template <typename Base>
+  void
+  parser::basic_symbol<Base>::move (basic_symbol& s)
+  {
+    super_type::move (s);
+    switch (this->kind ())
+    {
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        value.move< ExpressionList > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        value.move< NBlock* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        value.move< NCaseClause* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        value.move< NExpression* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        value.move< NFunction* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        value.move< NFunctionDeclaration* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        value.move< NIdentifier* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        value.move< NStatement* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        value.move< NSwitchStatement* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        value.move< NVariableDeclaration* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        value.move< NVariableDeclarationList* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        value.move< Symbol > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        value.move< int > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        value.move< std::string_view > (YY_MOVE (s.value));
+        break;
+
+      default:
+        break;
+    }
 
-#define YYACCEPT        goto yyacceptlab
-#define YYABORT         goto yyabortlab
-#define YYERROR         goto yyerrorlab
+    location = YY_MOVE (s.location);
+  }
 
+  // by_kind.
+  parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
 
-#define YYRECOVERING()  (!!yyerrstatus)
+#if 201103L <= YY_CPLUSPLUS
+  parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {
+    that.clear ();
+  }
+#endif
 
-#define YYBACKUP(Token, Value)                                    \
-  do                                                              \
-    if (yychar == YYEMPTY)                                        \
-      {                                                           \
-        yychar = (Token);                                         \
-        yylval = (Value);                                         \
-        YYPOPSTACK (yylen);                                       \
-        yystate = *yyssp;                                         \
-        goto yybackup;                                            \
-      }                                                           \
-    else                                                          \
-      {                                                           \
-        yyerror (YY_("syntax error: cannot back up")); \
-        YYERROR;                                                  \
-      }                                                           \
-  while (0)
+  parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
+  parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
 
 
 
-/* Enable debugging if requested.  */
-#if YYDEBUG
+  void
+  parser::by_kind::clear () YY_NOEXCEPT
+  {
+    kind_ = symbol_kind::S_YYEMPTY;
+  }
 
-# ifndef YYFPRINTF
-#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
-#  define YYFPRINTF fprintf
-# endif
+  void
+  parser::by_kind::move (by_kind& that)
+  {
+    kind_ = that.kind_;
+    that.clear ();
+  }
 
-# define YYDPRINTF(Args)                        \
-do {                                            \
-  if (yydebug)                                  \
-    YYFPRINTF Args;                             \
-} while (0)
+  parser::symbol_kind_type
+  parser::by_kind::kind () const YY_NOEXCEPT
+  {
+    return kind_;
+  }
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
+  parser::symbol_kind_type
+  parser::by_kind::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
-do {                                                                      \
-  if (yydebug)                                                            \
-    {                                                                     \
-      YYFPRINTF (stderr, "%s ", Title);                                   \
-      yy_symbol_print (stderr,                                            \
-                  Type, Value); \
-      YYFPRINTF (stderr, "\n");                                           \
-    }                                                                     \
-} while (0)
 
 
-/*-----------------------------------.
-| Print this symbol's value on YYO.  |
-`-----------------------------------*/
+  // by_state.
+  parser::by_state::by_state () YY_NOEXCEPT
+    : state (empty_state)
+  {}
 
-static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
-{
-  FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
-  if (!yyvaluep)
-    return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
-  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
-  YY_IGNORE_MAYBE_UNINITIALIZED_END
-}
+  parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
+  {}
 
+  void
+  parser::by_state::clear () YY_NOEXCEPT
+  {
+    state = empty_state;
+  }
 
-/*---------------------------.
-| Print this symbol on YYO.  |
-`---------------------------*/
+  void
+  parser::by_state::move (by_state& that)
+  {
+    state = that.state;
+    that.clear ();
+  }
 
-static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
-{
-  YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  parser::by_state::by_state (state_type s) YY_NOEXCEPT
+    : state (s)
+  {}
 
-  yy_symbol_value_print (yyo, yytype, yyvaluep);
-  YYFPRINTF (yyo, ")");
-}
+  parser::symbol_kind_type
+  parser::by_state::kind () const YY_NOEXCEPT
+  {
+    if (state == empty_state)
+      return symbol_kind::S_YYEMPTY;
+    else
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
+  }
 
-/*------------------------------------------------------------------.
-| yy_stack_print -- Print the state stack from its BOTTOM up to its |
-| TOP (included).                                                   |
-`------------------------------------------------------------------*/
+  parser::stack_symbol_type::stack_symbol_type ()
+  {}
 
-static void
-yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
-{
-  YYFPRINTF (stderr, "Stack now");
-  for (; yybottom <= yytop; yybottom++)
+  parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
     {
-      int yybot = *yybottom;
-      YYFPRINTF (stderr, " %d", yybot);
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        value.YY_MOVE_OR_COPY< ExpressionList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        value.YY_MOVE_OR_COPY< NBlock* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        value.YY_MOVE_OR_COPY< NCaseClause* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        value.YY_MOVE_OR_COPY< NExpression* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        value.YY_MOVE_OR_COPY< NFunction* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        value.YY_MOVE_OR_COPY< NFunctionDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        value.YY_MOVE_OR_COPY< NIdentifier* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        value.YY_MOVE_OR_COPY< NStatement* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        value.YY_MOVE_OR_COPY< NSwitchStatement* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        value.YY_MOVE_OR_COPY< NVariableDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        value.YY_MOVE_OR_COPY< NVariableDeclarationList* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        value.YY_MOVE_OR_COPY< Symbol > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        value.YY_MOVE_OR_COPY< int > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        value.YY_MOVE_OR_COPY< std::string_view > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
     }
-  YYFPRINTF (stderr, "\n");
-}
 
-# define YY_STACK_PRINT(Bottom, Top)                            \
-do {                                                            \
-  if (yydebug)                                                  \
-    yy_stack_print ((Bottom), (Top));                           \
-} while (0)
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
 
+  parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        value.move< ExpressionList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        value.move< NBlock* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        value.move< NCaseClause* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        value.move< NExpression* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        value.move< NFunction* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        value.move< NFunctionDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        value.move< NIdentifier* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        value.move< NStatement* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        value.move< NSwitchStatement* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        value.move< NVariableDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        value.move< NVariableDeclarationList* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        value.move< Symbol > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        value.move< int > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        value.move< std::string_view > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
 
-/*------------------------------------------------.
-| Report that the YYRULE is going to be reduced.  |
-`------------------------------------------------*/
+    // that is emptied.
+    that.kind_ = symbol_kind::S_YYEMPTY;
+  }
 
-static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule)
-{
-  int yylno = yyrline[yyrule];
-  int yynrhs = yyr2[yyrule];
-  int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
-             yyrule - 1, yylno);
-  /* The symbols being reduced.  */
-  for (yyi = 0; yyi < yynrhs; yyi++)
+#if YY_CPLUSPLUS < 201103L
+  parser::stack_symbol_type&
+  parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
     {
-      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr,
-                       yystos[+yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                                              );
-      YYFPRINTF (stderr, "\n");
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        value.copy< ExpressionList > (that.value);
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        value.copy< NBlock* > (that.value);
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        value.copy< NCaseClause* > (that.value);
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        value.copy< NExpression* > (that.value);
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        value.copy< NFunction* > (that.value);
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        value.copy< NFunctionDeclaration* > (that.value);
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        value.copy< NIdentifier* > (that.value);
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        value.copy< NStatement* > (that.value);
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        value.copy< NSwitchStatement* > (that.value);
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        value.copy< NVariableDeclaration* > (that.value);
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        value.copy< NVariableDeclarationList* > (that.value);
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        value.copy< Symbol > (that.value);
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        value.copy< int > (that.value);
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        value.copy< std::string_view > (that.value);
+        break;
+
+      default:
+        break;
     }
-}
-
-# define YY_REDUCE_PRINT(Rule)          \
-do {                                    \
-  if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, Rule); \
-} while (0)
-
-/* Nonzero means print parse trace.  It is left uninitialized so that
-   multiple parsers can coexist.  */
-int yydebug;
-#else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
-# define YY_STACK_PRINT(Bottom, Top)
-# define YY_REDUCE_PRINT(Rule)
-#endif /* !YYDEBUG */
-
-
-/* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef YYINITDEPTH
-# define YYINITDEPTH 200
-#endif
 
-/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
-   if the built-in stack extension method is used).
+    location = that.location;
+    return *this;
+  }
 
-   Do not make this value too large; the results are undefined if
-   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
-   evaluated with infinite-precision integer arithmetic.  */
+  parser::stack_symbol_type&
+  parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        value.move< ExpressionList > (that.value);
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        value.move< NBlock* > (that.value);
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        value.move< NCaseClause* > (that.value);
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        value.move< NExpression* > (that.value);
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        value.move< NFunction* > (that.value);
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        value.move< NFunctionDeclaration* > (that.value);
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        value.move< NIdentifier* > (that.value);
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        value.move< NStatement* > (that.value);
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        value.move< NSwitchStatement* > (that.value);
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        value.move< NVariableDeclaration* > (that.value);
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        value.move< NVariableDeclarationList* > (that.value);
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        value.move< Symbol > (that.value);
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        value.move< int > (that.value);
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        value.move< std::string_view > (that.value);
+        break;
+
+      default:
+        break;
+    }
 
-#ifndef YYMAXDEPTH
-# define YYMAXDEPTH 10000
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
 #endif
 
+  template <typename Base>
+  void
+  parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
+  {
+    if (yymsg)
+      YY_SYMBOL_PRINT (yymsg, yysym);
+  }
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
-#  else
-/* Return the length of YYSTR.  */
-static YYPTRDIFF_T
-yystrlen (const char *yystr)
-{
-  YYPTRDIFF_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
+#if YYDEBUG
+  template <typename Base>
+  void
+  parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
+  {
+    std::ostream& yyoutput = yyo;
+    YY_USE (yyoutput);
+    if (yysym.empty ())
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
+      }
+  }
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
+  void
+  parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
+  {
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
+  }
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
+  void
+  parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
+  {
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
+  }
 
-  return yyd - 1;
-}
-#  endif
-# endif
+  void
+  parser::yypop_ (int n) YY_NOEXCEPT
+  {
+    yystack_.pop (n);
+  }
 
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYPTRDIFF_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYPTRDIFF_T yyn = 0;
-      char const *yyp = yystr;
+#if YYDEBUG
+  std::ostream&
+  parser::debug_stream () const
+  {
+    return *yycdebug_;
+  }
 
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            else
-              goto append;
-
-          append:
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
+  void
+  parser::set_debug_stream (std::ostream& o)
+  {
+    yycdebug_ = &o;
+  }
 
-  if (yyres)
-    return yystpcpy (yyres, yystr) - yyres;
-  else
-    return yystrlen (yystr);
-}
-# endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                yy_state_t *yyssp, int yytoken)
-{
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat: reported tokens (one for the "unexpected",
-     one per "expected"). */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Actual size of YYARG. */
-  int yycount = 0;
-  /* Cumulated lengths of YYARG.  */
-  YYPTRDIFF_T yysize = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[+*yyssp];
-      YYPTRDIFF_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-      yysize = yysize0;
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYPTRDIFF_T yysize1
-                    = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
-    }
+  parser::debug_level_type
+  parser::debug_level () const
+  {
+    return yydebug_;
+  }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
+  void
+  parser::set_debug_level (debug_level_type l)
+  {
+    yydebug_ = l;
+  }
+#endif // YYDEBUG
 
+  parser::state_type
+  parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    /* Don't count the "%s"s in the final size, but reserve room for
-       the terminator.  */
-    YYPTRDIFF_T yysize1 = yysize + (yystrlen (yyformat) - 2 * yycount) + 1;
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
+    if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
+      return yytable_[yyr];
     else
-      return 2;
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
+  bool
+  parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          ++yyp;
-          ++yyformat;
-        }
+    return yyvalue == yypact_ninf_;
   }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
-
-/*-----------------------------------------------.
-| Release the memory associated to this symbol.  |
-`-----------------------------------------------*/
-
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-{
-  YYUSE (yyvaluep);
-  if (!yymsg)
-    yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
-  YY_IGNORE_MAYBE_UNINITIALIZED_END
-}
-
 
+  bool
+  parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yytable_ninf_;
+  }
 
+  int
+  parser::operator() ()
+  {
+    return parse ();
+  }
 
-/* The lookahead symbol.  */
-int yychar;
+  int
+  parser::parse ()
+  {
+    int yyn;
+    /// Length of the RHS of the rule being reduced.
+    int yylen = 0;
 
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-/* Number of syntax errors so far.  */
-int yynerrs;
+    // Error handling.
+    int yynerrs_ = 0;
+    int yyerrstatus_ = 0;
 
+    /// The lookahead symbol.
+    symbol_type yyla;
 
-/*----------.
-| yyparse.  |
-`----------*/
+    /// The locations where the error started and ended.
+    stack_symbol_type yyerror_range[3];
 
-int
-yyparse (void)
-{
-    yy_state_fast_t yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
-       to reallocate them elsewhere.  */
-
-    /* The state stack.  */
-    yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
-
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
-
-    YYPTRDIFF_T yystacksize;
-
-  int yyn;
-  int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-  /* The variables used to return semantic value and location from the
-     action routines.  */
-  YYSTYPE yyval;
-
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+    /// The return value of parse ().
+    int yyresult;
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+#if YY_EXCEPTIONS
+    try
+#endif // YY_EXCEPTIONS
+      {
+    YYCDEBUG << "Starting parse\n";
 
-  /* The number of symbols on the RHS of the reduced rule.
-     Keep to zero when no symbol should be popped.  */
-  int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
+    /* Initialize the stack.  The initial state will be set in
+       yynewstate, since the latter expects the semantical and the
+       location values to have been already stored, initialize these
+       stacks with a primary value.  */
+    yystack_.clear ();
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-  YYDPRINTF ((stderr, "Starting parse\n"));
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
+  yynewstate:
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
-  goto yysetstate;
+    // Accept?
+    if (yystack_[0].state == yyfinal_)
+      YYACCEPT;
 
+    goto yybackup;
 
-/*------------------------------------------------------------.
-| yynewstate -- push a new state, which is found in yystate.  |
-`------------------------------------------------------------*/
-yynewstate:
-  /* In all cases, when you get here, the value and location stacks
-     have just been pushed.  So pushing a state here evens the stacks.  */
-  yyssp++;
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
+    // Try to take a decision without lookahead.
+    yyn = yypact_[+yystack_[0].state];
+    if (yy_pact_value_is_default_ (yyn))
+      goto yydefault;
 
-/*--------------------------------------------------------------------.
-| yysetstate -- set current state (the top of the stack) to yystate.  |
-`--------------------------------------------------------------------*/
-yysetstate:
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
-  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
-  YY_IGNORE_USELESS_CAST_BEGIN
-  *yyssp = YY_CAST (yy_state_t, yystate);
-  YY_IGNORE_USELESS_CAST_END
+    // Read a lookahead token.
+    if (yyla.empty ())
+      {
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
+        try
+#endif // YY_EXCEPTIONS
+          {
+            yyla.kind_ = yytranslate_ (yylex (&yyla.value, &yyla.location, scanner));
+          }
+#if YY_EXCEPTIONS
+        catch (const syntax_error& yyexc)
+          {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+            error (yyexc);
+            goto yyerrlab1;
+          }
+#endif // YY_EXCEPTIONS
+      }
+    YY_SYMBOL_PRINT ("Next token is", yyla);
 
-  if (yyss + yystacksize - 1 <= yyssp)
-#if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
-#else
+    if (yyla.kind () == symbol_kind::S_YYerror)
     {
-      /* Get the current used size of the three stacks, in elements.  */
-      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
 
-# if defined yyoverflow
+    /* If the proper action on seeing token YYLA.TYPE is to reduce or
+       to detect an error, take that action.  */
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
       {
-        /* Give user a chance to reallocate the stack.  Use copies of
-           these so that the &'s don't force the real ones into
-           memory.  */
-        yy_state_t *yyss1 = yyss;
-        YYSTYPE *yyvs1 = yyvs;
-
-        /* Each stack pointer address is followed by the size of the
-           data in use in that stack, in bytes.  This used to be a
-           conditional around just the two extra args, but that might
-           be undefined if yyoverflow is a macro.  */
-        yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * YYSIZEOF (*yyssp),
-                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
-                    &yystacksize);
-        yyss = yyss1;
-        yyvs = yyvs1;
+        goto yydefault;
       }
-# else /* defined YYSTACK_RELOCATE */
-      /* Extend the stack our own way.  */
-      if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
-      yystacksize *= 2;
-      if (YYMAXDEPTH < yystacksize)
-        yystacksize = YYMAXDEPTH;
 
+    // Reduce or error.
+    yyn = yytable_[yyn];
+    if (yyn <= 0)
       {
-        yy_state_t *yyss1 = yyss;
-        union yyalloc *yyptr =
-          YY_CAST (union yyalloc *,
-                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
-        if (! yyptr)
-          goto yyexhaustedlab;
-        YYSTACK_RELOCATE (yyss_alloc, yyss);
-        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
-# undef YYSTACK_RELOCATE
-        if (yyss1 != yyssa)
-          YYSTACK_FREE (yyss1);
+        if (yy_table_value_is_error_ (yyn))
+          goto yyerrlab;
+        yyn = -yyn;
+        goto yyreduce;
       }
-# endif
-
-      yyssp = yyss + yysize - 1;
-      yyvsp = yyvs + yysize - 1;
-
-      YY_IGNORE_USELESS_CAST_BEGIN
-      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
-                  YY_CAST (long, yystacksize)));
-      YY_IGNORE_USELESS_CAST_END
-
-      if (yyss + yystacksize - 1 <= yyssp)
-        YYABORT;
-    }
-#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
-
-  if (yystate == YYFINAL)
-    YYACCEPT;
-
-  goto yybackup;
 
+    // Count tokens shifted since error; after three, turn off error status.
+    if (yyerrstatus_)
+      --yyerrstatus_;
 
-/*-----------.
-| yybackup.  |
-`-----------*/
-yybackup:
-  /* Do appropriate processing given the current state.  Read a
-     lookahead token if we need one and don't already have one.  */
+    // Shift the lookahead token.
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
+    goto yynewstate;
 
-  /* First try to decide what to do without reference to lookahead token.  */
-  yyn = yypact[yystate];
-  if (yypact_value_is_default (yyn))
-    goto yydefault;
 
-  /* Not known => get a lookahead token if don't already have one.  */
+  /*-----------------------------------------------------------.
+  | yydefault -- do the default action for the current state.  |
+  `-----------------------------------------------------------*/
+  yydefault:
+    yyn = yydefact_[+yystack_[0].state];
+    if (yyn == 0)
+      goto yyerrlab;
+    goto yyreduce;
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
-    {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = yylex ();
-    }
 
-  if (yychar <= YYEOF)
+  /*-----------------------------.
+  | yyreduce -- do a reduction.  |
+  `-----------------------------*/
+  yyreduce:
+    yylen = yyr2_[yyn];
     {
-      yychar = yytoken = YYEOF;
-      YYDPRINTF ((stderr, "Now at end of input.\n"));
-    }
-  else
+      stack_symbol_type yylhs;
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
+      /* Variants are always initialized to an empty instance of the
+         correct type. The default '$$ = $1' action is NOT applied
+         when using variants.  */
+      switch (yyr1_[yyn])
     {
-      yytoken = YYTRANSLATE (yychar);
-      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+      case symbol_kind::S_argument_expression_list: // argument_expression_list
+        yylhs.value.emplace< ExpressionList > ();
+        break;
+
+      case symbol_kind::S_statement_list: // statement_list
+      case symbol_kind::S_compound_statement: // compound_statement
+        yylhs.value.emplace< NBlock* > ();
+        break;
+
+      case symbol_kind::S_switch_clause: // switch_clause
+        yylhs.value.emplace< NCaseClause* > ();
+        break;
+
+      case symbol_kind::S_primary_expression: // primary_expression
+      case symbol_kind::S_postfix_expression: // postfix_expression
+      case symbol_kind::S_unary_expression: // unary_expression
+      case symbol_kind::S_cast_expression: // cast_expression
+      case symbol_kind::S_multiplicative_expression: // multiplicative_expression
+      case symbol_kind::S_additive_expression: // additive_expression
+      case symbol_kind::S_shift_expression: // shift_expression
+      case symbol_kind::S_relational_expression: // relational_expression
+      case symbol_kind::S_equality_expression: // equality_expression
+      case symbol_kind::S_and_expression: // and_expression
+      case symbol_kind::S_exclusive_or_expression: // exclusive_or_expression
+      case symbol_kind::S_inclusive_or_expression: // inclusive_or_expression
+      case symbol_kind::S_logical_and_expression: // logical_and_expression
+      case symbol_kind::S_logical_or_expression: // logical_or_expression
+      case symbol_kind::S_conditional_expression: // conditional_expression
+      case symbol_kind::S_assignment_expression: // assignment_expression
+      case symbol_kind::S_expression: // expression
+      case symbol_kind::S_constant_expression: // constant_expression
+        yylhs.value.emplace< NExpression* > ();
+        break;
+
+      case symbol_kind::S_function_definition: // function_definition
+        yylhs.value.emplace< NFunction* > ();
+        break;
+
+      case symbol_kind::S_func_declarator: // func_declarator
+        yylhs.value.emplace< NFunctionDeclaration* > ();
+        break;
+
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_direct_declarator: // direct_declarator
+        yylhs.value.emplace< NIdentifier* > ();
+        break;
+
+      case symbol_kind::S_declaration_statement: // declaration_statement
+      case symbol_kind::S_expression_statement: // expression_statement
+      case symbol_kind::S_selection_statement: // selection_statement
+      case symbol_kind::S_iteration_statement: // iteration_statement
+      case symbol_kind::S_jump_statement: // jump_statement
+      case symbol_kind::S_statement: // statement
+        yylhs.value.emplace< NStatement* > ();
+        break;
+
+      case symbol_kind::S_switch_clause_list: // switch_clause_list
+        yylhs.value.emplace< NSwitchStatement* > ();
+        break;
+
+      case symbol_kind::S_init_declarator: // init_declarator
+      case symbol_kind::S_parameter_declaration: // parameter_declaration
+        yylhs.value.emplace< NVariableDeclaration* > ();
+        break;
+
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_init_declarator_list: // init_declarator_list
+      case symbol_kind::S_parameter_list: // parameter_list
+        yylhs.value.emplace< NVariableDeclarationList* > ();
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+        yylhs.value.emplace< Symbol > ();
+        break;
+
+      case symbol_kind::S_SIZEOF: // SIZEOF
+      case symbol_kind::S_PTR_OP: // PTR_OP
+      case symbol_kind::S_INC_OP: // INC_OP
+      case symbol_kind::S_DEC_OP: // DEC_OP
+      case symbol_kind::S_LEFT_OP: // LEFT_OP
+      case symbol_kind::S_RIGHT_OP: // RIGHT_OP
+      case symbol_kind::S_LE_OP: // LE_OP
+      case symbol_kind::S_GE_OP: // GE_OP
+      case symbol_kind::S_EQ_OP: // EQ_OP
+      case symbol_kind::S_NE_OP: // NE_OP
+      case symbol_kind::S_AND_OP: // AND_OP
+      case symbol_kind::S_OR_OP: // OR_OP
+      case symbol_kind::S_MUL_ASSIGN: // MUL_ASSIGN
+      case symbol_kind::S_DIV_ASSIGN: // DIV_ASSIGN
+      case symbol_kind::S_MOD_ASSIGN: // MOD_ASSIGN
+      case symbol_kind::S_ADD_ASSIGN: // ADD_ASSIGN
+      case symbol_kind::S_SUB_ASSIGN: // SUB_ASSIGN
+      case symbol_kind::S_LEFT_ASSIGN: // LEFT_ASSIGN
+      case symbol_kind::S_RIGHT_ASSIGN: // RIGHT_ASSIGN
+      case symbol_kind::S_AND_ASSIGN: // AND_ASSIGN
+      case symbol_kind::S_XOR_ASSIGN: // XOR_ASSIGN
+      case symbol_kind::S_OR_ASSIGN: // OR_ASSIGN
+      case symbol_kind::S_TYPE_NAME: // TYPE_NAME
+      case symbol_kind::S_NEG_OP: // NEG_OP
+      case symbol_kind::S_ADD_OP: // ADD_OP
+      case symbol_kind::S_MUL_OP: // MUL_OP
+      case symbol_kind::S_DIV_OP: // DIV_OP
+      case symbol_kind::S_MOD_OP: // MOD_OP
+      case symbol_kind::S_LT_OP: // LT_OP
+      case symbol_kind::S_GT_OP: // GT_OP
+      case symbol_kind::S_CHAR: // CHAR
+      case symbol_kind::S_SHORT: // SHORT
+      case symbol_kind::S_INT: // INT
+      case symbol_kind::S_LONG: // LONG
+      case symbol_kind::S_SIGNED: // SIGNED
+      case symbol_kind::S_UNSIGNED: // UNSIGNED
+      case symbol_kind::S_FLOAT: // FLOAT
+      case symbol_kind::S_DOUBLE: // DOUBLE
+      case symbol_kind::S_VOID: // VOID
+      case symbol_kind::S_type_specifier: // type_specifier
+      case symbol_kind::S_pointer: // pointer
+        yylhs.value.emplace< int > ();
+        break;
+
+      case symbol_kind::S_CONSTANT: // CONSTANT
+      case symbol_kind::S_STRING_LITERAL: // STRING_LITERAL
+        yylhs.value.emplace< std::string_view > ();
+        break;
+
+      default:
+        break;
     }
 
-  /* If the proper action on seeing token YYTOKEN is to reduce or to
-     detect an error, take that action.  */
-  yyn += yytoken;
-  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
-    goto yydefault;
-  yyn = yytable[yyn];
-  if (yyn <= 0)
-    {
-      if (yytable_value_is_error (yyn))
-        goto yyerrlab;
-      yyn = -yyn;
-      goto yyreduce;
-    }
 
-  /* Count tokens shifted since error; after three, turn off error
-     status.  */
-  if (yyerrstatus)
-    yyerrstatus--;
-
-  /* Shift the lookahead token.  */
-  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-  yystate = yyn;
-  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  *++yyvsp = yylval;
-  YY_IGNORE_MAYBE_UNINITIALIZED_END
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-  goto yynewstate;
-
-
-/*-----------------------------------------------------------.
-| yydefault -- do the default action for the current state.  |
-`-----------------------------------------------------------*/
-yydefault:
-  yyn = yydefact[yystate];
-  if (yyn == 0)
-    goto yyerrlab;
-  goto yyreduce;
-
-
-/*-----------------------------.
-| yyreduce -- do a reduction.  |
-`-----------------------------*/
-yyreduce:
-  /* yyn is the number of a rule to reduce with.  */
-  yylen = yyr2[yyn];
-
-  /* If YYLEN is nonzero, implement the default value of the action:
-     '$$ = $1'.
-
-     Otherwise, the following line sets YYVAL to garbage.
-     This behavior is undocumented and Bison
-     users should not rely upon it.  Assigning to YYVAL
-     unconditionally makes the parser a bit smaller, and it avoids a
-     GCC warning that YYVAL may be used uninitialized.  */
-  yyval = yyvsp[1-yylen];
-
-
-  YY_REDUCE_PRINT (yyn);
-  switch (yyn)
-    {
-  case 2:
+      // Default location.
+      {
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
+      }
+
+      // Perform the reduction.
+      YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
+      try
+#endif // YY_EXCEPTIONS
+        {
+          switch (yyn)
+            {
+  case 2: // primary_expression: IDENTIFIER
 #line 69 "semic.y"
                      {
-		(yyval.expr) = new NIdentifier(std::shared_ptr<std::string>((yyvsp[0].string)));
+		yylhs.value.as < NExpression* > () = unit.arena.make<NIdentifier>(yystack_[0].value.as < Symbol > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[0].location);
 	}
-#line 1532 "semic_grammar.cpp"
+#line 1510 "semic_grammar.cpp"
     break;
 
-  case 3:
-#line 72 "semic.y"
+  case 3: // primary_expression: CONSTANT
+#line 73 "semic.y"
                    {
-        (yyval.expr) = new NInteger(std::stoll(*(yyvsp[0].string)));
-		delete (yyvsp[0].string);
+        yylhs.value.as < NExpression* > () = unit.arena.make<NInteger>(parse_integer(yystack_[0].value.as < std::string_view > ()));
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[0].location);
 	}
-#line 1541 "semic_grammar.cpp"
+#line 1519 "semic_grammar.cpp"
     break;
 
-  case 4:
-#line 76 "semic.y"
+  case 4: // primary_expression: '(' expression ')'
+#line 77 "semic.y"
                          {
-        (yyval.expr) = (yyvsp[-1].expr);
+        yylhs.value.as < NExpression* > () = yystack_[1].value.as < NExpression* > ();
     }
-#line 1549 "semic_grammar.cpp"
+#line 1527 "semic_grammar.cpp"
     break;
 
-  case 5:
-#line 79 "semic.y"
+  case 5: // primary_expression: STRING_LITERAL
+#line 80 "semic.y"
                          {
-        (yyval.expr) = new NStringLiteral(
-            std::shared_ptr<std::string>((yyvsp[0].string))
-        );
+        yylhs.value.as < NExpression* > () = unit.arena.make<NStringLiteral>(std::string(yystack_[0].value.as < std::string_view > ()));
+        LOCATE(yylhs.value.as < NExpression* > (), yystack_[0].location);
     }
-#line 1559 "semic_grammar.cpp"
+#line 1536 "semic_grammar.cpp"
     break;
 
-  case 7:
+  case 6: // postfix_expression: primary_expression
+#line 87 "semic.y"
+                             { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1542 "semic_grammar.cpp"
+    break;
+
+  case 7: // postfix_expression: postfix_expression '[' expression ']'
 #line 88 "semic.y"
                                                 {
-        (yyval.expr) = new NArrayIndex(
-            std::shared_ptr<NExpression>((yyvsp[-3].expr)),
-            std::shared_ptr<NExpression>((yyvsp[-1].expr))
+        yylhs.value.as < NExpression* > () = unit.arena.make<NArrayIndex>(
+            yystack_[3].value.as < NExpression* > (),
+            yystack_[1].value.as < NExpression* > ()
         );
+        LOCATE(yylhs.value.as < NExpression* > (), yystack_[2].location);
     }
-#line 1570 "semic_grammar.cpp"
+#line 1554 "semic_grammar.cpp"
     break;
 
-  case 8:
-#line 94 "semic.y"
+  case 8: // postfix_expression: IDENTIFIER '(' ')'
+#line 95 "semic.y"
                              {
-        (yyval.expr) = new NMethodCall(
-            std::make_shared<NIdentifier>(
-                std::shared_ptr<std::string>((yyvsp[-2].string))
-            ) 
+        yylhs.value.as < NExpression* > () = unit.arena.make<NMethodCall>(
+            unit.arena.make<NIdentifier>(yystack_[2].value.as < Symbol > ())
         );
+        LOCATE(yylhs.value.as < NExpression* > (), yystack_[2].location);
     }
-#line 1582 "semic_grammar.cpp"
+#line 1565 "semic_grammar.cpp"
     break;
 
-  case 9:
+  case 9: // postfix_expression: IDENTIFIER '(' argument_expression_list ')'
 #line 101 "semic.y"
                                                       {
-        (yyval.expr) = new NMethodCall(
-            std::make_shared<NIdentifier>(
-                std::shared_ptr<std::string>((yyvsp[-3].string))
-            ),
-            std::shared_ptr<ExpressionList>((yyvsp[-1].expr_list))
+        yylhs.value.as < NExpression* > () = unit.arena.make<NMethodCall>(
+            unit.arena.make<NIdentifier>(yystack_[3].value.as < Symbol > ()),
+            std::move(yystack_[1].value.as < ExpressionList > ())
         );
+        LOCATE(yylhs.value.as < NExpression* > (), yystack_[3].location);
     }
-#line 1595 "semic_grammar.cpp"
+#line 1577 "semic_grammar.cpp"
     break;
 
-  case 10:
-#line 113 "semic.y"
+  case 10: // postfix_expression: postfix_expression INC_OP
+#line 112 "semic.y"
                                     {
-        (yyval.expr) = new NUnaryOperator(
-            std::shared_ptr<NExpression>((yyvsp[-1].expr)),
-            (yyvsp[0].token)
+        yylhs.value.as < NExpression* > () = unit.arena.make<NUnaryOperator>(
+            yystack_[1].value.as < NExpression* > (),
+            yystack_[0].value.as < int > ()
         );
+        LOCATE(yylhs.value.as < NExpression* > (), yystack_[0].location);
     }
-#line 1606 "semic_grammar.cpp"
+#line 1589 "semic_grammar.cpp"
     break;
 
-  case 11:
+  case 11: // postfix_expression: postfix_expression DEC_OP
 #line 119 "semic.y"
                                     {
-        (yyval.expr) = new NUnaryOperator(
-            std::shared_ptr<NExpression>((yyvsp[-1].expr)),
-            (yyvsp[0].token)
+        yylhs.value.as < NExpression* > () = unit.arena.make<NUnaryOperator>(
+            yystack_[1].value.as < NExpression* > (),
+            yystack_[0].value.as < int > ()
         );
+        LOCATE(yylhs.value.as < NExpression* > (), yystack_[0].location);
     }
-#line 1617 "semic_grammar.cpp"
+#line 1601 "semic_grammar.cpp"
     break;
 
-  case 12:
-#line 128 "semic.y"
+  case 12: // argument_expression_list: assignment_expression
+#line 129 "semic.y"
                                 {
-		(yyval.expr_list) = new ExpressionList();
-		(yyval.expr_list)->push_back(std::shared_ptr<NExpression>((yyvsp[0].expr)));
+		yylhs.value.as < ExpressionList > ().push_back(yystack_[0].value.as < NExpression* > ());
     }
-#line 1626 "semic_grammar.cpp"
+#line 1609 "semic_grammar.cpp"
     break;
 
-  case 13:
+  case 13: // argument_expression_list: argument_expression_list ',' assignment_expression
 #line 132 "semic.y"
                                                              {
-		(yyvsp[-2].expr_list)->push_back(std::shared_ptr<NExpression>((yyvsp[0].expr)));
+		yylhs.value.as < ExpressionList > () = std::move(yystack_[2].value.as < ExpressionList > ());
+		yylhs.value.as < ExpressionList > ().push_back(yystack_[0].value.as < NExpression* > ());
     }
-#line 1634 "semic_grammar.cpp"
+#line 1618 "semic_grammar.cpp"
     break;
 
-  case 15:
+  case 14: // unary_expression: postfix_expression
 #line 139 "semic.y"
+                             { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1624 "semic_grammar.cpp"
+    break;
+
+  case 15: // unary_expression: INC_OP unary_expression
+#line 140 "semic.y"
                                   {
-        (yyval.expr) = new NUnaryOperator(
-            std::shared_ptr<NExpression>((yyvsp[0].expr)),
-            (yyvsp[-1].token)
+        yylhs.value.as < NExpression* > () = unit.arena.make<NUnaryOperator>(
+            yystack_[0].value.as < NExpression* > (),
+            yystack_[1].value.as < int > ()
         );
+        LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
     }
-#line 1645 "semic_grammar.cpp"
+#line 1636 "semic_grammar.cpp"
     break;
 
-  case 16:
-#line 145 "semic.y"
+  case 16: // unary_expression: DEC_OP unary_expression
+#line 147 "semic.y"
                                   {
-        (yyval.expr) = new NUnaryOperator(
-            std::shared_ptr<NExpression>((yyvsp[0].expr)),
-            (yyvsp[-1].token)
+        yylhs.value.as < NExpression* > () = unit.arena.make<NUnaryOperator>(
+            yystack_[0].value.as < NExpression* > (),
+            yystack_[1].value.as < int > ()
         );
+        LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
     }
-#line 1656 "semic_grammar.cpp"
+#line 1648 "semic_grammar.cpp"
+    break;
+
+  case 17: // cast_expression: unary_expression
+#line 175 "semic.y"
+                           { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1654 "semic_grammar.cpp"
     break;
 
-  case 18:
-#line 177 "semic.y"
+  case 18: // multiplicative_expression: multiplicative_expression MUL_OP cast_expression
+#line 180 "semic.y"
                                                            {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
 	}
-#line 1666 "semic_grammar.cpp"
+#line 1663 "semic_grammar.cpp"
     break;
 
-  case 19:
-#line 182 "semic.y"
+  case 19: // multiplicative_expression: multiplicative_expression DIV_OP cast_expression
+#line 184 "semic.y"
                                                            {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
 	}
-#line 1676 "semic_grammar.cpp"
+#line 1672 "semic_grammar.cpp"
     break;
 
-  case 20:
-#line 187 "semic.y"
+  case 20: // multiplicative_expression: multiplicative_expression MOD_OP cast_expression
+#line 188 "semic.y"
                                                            {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
 	}
-#line 1686 "semic_grammar.cpp"
+#line 1681 "semic_grammar.cpp"
     break;
 
-  case 23:
+  case 21: // multiplicative_expression: cast_expression
+#line 192 "semic.y"
+                          { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1687 "semic_grammar.cpp"
+    break;
+
+  case 22: // additive_expression: multiplicative_expression
+#line 196 "semic.y"
+                                    { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1693 "semic_grammar.cpp"
+    break;
+
+  case 23: // additive_expression: additive_expression ADD_OP multiplicative_expression
 #line 197 "semic.y"
                                                                {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
 	}
-#line 1696 "semic_grammar.cpp"
+#line 1702 "semic_grammar.cpp"
     break;
 
-  case 24:
-#line 202 "semic.y"
+  case 24: // additive_expression: additive_expression NEG_OP multiplicative_expression
+#line 201 "semic.y"
                                                                {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
 	}
-#line 1706 "semic_grammar.cpp"
+#line 1711 "semic_grammar.cpp"
+    break;
+
+  case 25: // shift_expression: additive_expression
+#line 208 "semic.y"
+                              { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1717 "semic_grammar.cpp"
+    break;
+
+  case 26: // shift_expression: shift_expression LEFT_OP additive_expression
+#line 209 "semic.y"
+                                                       {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
+	}
+#line 1726 "semic_grammar.cpp"
+    break;
+
+  case 27: // shift_expression: shift_expression RIGHT_OP additive_expression
+#line 213 "semic.y"
+                                                        {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
+	}
+#line 1735 "semic_grammar.cpp"
+    break;
+
+  case 28: // relational_expression: shift_expression
+#line 220 "semic.y"
+                           { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1741 "semic_grammar.cpp"
+    break;
+
+  case 29: // relational_expression: relational_expression LT_OP shift_expression
+#line 221 "semic.y"
+                                                       {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
+	}
+#line 1750 "semic_grammar.cpp"
+    break;
+
+  case 30: // relational_expression: relational_expression GT_OP shift_expression
+#line 225 "semic.y"
+                                                       {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
+	}
+#line 1759 "semic_grammar.cpp"
+    break;
+
+  case 31: // relational_expression: relational_expression LE_OP shift_expression
+#line 229 "semic.y"
+                                                       {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
+	}
+#line 1768 "semic_grammar.cpp"
+    break;
+
+  case 32: // relational_expression: relational_expression GE_OP shift_expression
+#line 233 "semic.y"
+                                                       {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
+	}
+#line 1777 "semic_grammar.cpp"
+    break;
+
+  case 33: // equality_expression: relational_expression
+#line 240 "semic.y"
+                                { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1783 "semic_grammar.cpp"
+    break;
+
+  case 34: // equality_expression: equality_expression EQ_OP relational_expression
+#line 241 "semic.y"
+                                                          {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
+	}
+#line 1792 "semic_grammar.cpp"
+    break;
+
+  case 35: // equality_expression: equality_expression NE_OP relational_expression
+#line 245 "semic.y"
+                                                          {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NBinaryOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
+	}
+#line 1801 "semic_grammar.cpp"
+    break;
+
+  case 36: // and_expression: equality_expression
+#line 252 "semic.y"
+                              { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1807 "semic_grammar.cpp"
+    break;
+
+  case 37: // exclusive_or_expression: and_expression
+#line 257 "semic.y"
+                         { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1813 "semic_grammar.cpp"
+    break;
+
+  case 38: // inclusive_or_expression: exclusive_or_expression
+#line 262 "semic.y"
+                                  { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1819 "semic_grammar.cpp"
     break;
 
-  case 26:
-#line 211 "semic.y"
-                                                       {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
-	}
-#line 1716 "semic_grammar.cpp"
+  case 39: // logical_and_expression: inclusive_or_expression
+#line 267 "semic.y"
+                                  { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1825 "semic_grammar.cpp"
     break;
 
-  case 27:
-#line 216 "semic.y"
-                                                        {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
+  case 40: // logical_and_expression: logical_and_expression AND_OP inclusive_or_expression
+#line 268 "semic.y"
+                                                                {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NLogicalOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
 	}
-#line 1726 "semic_grammar.cpp"
+#line 1834 "semic_grammar.cpp"
     break;
 
-  case 29:
-#line 225 "semic.y"
-                                                       {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
-	}
-#line 1736 "semic_grammar.cpp"
+  case 41: // logical_or_expression: logical_and_expression
+#line 275 "semic.y"
+                                 { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1840 "semic_grammar.cpp"
     break;
 
-  case 30:
-#line 230 "semic.y"
-                                                       {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
+  case 42: // logical_or_expression: logical_or_expression OR_OP logical_and_expression
+#line 276 "semic.y"
+                                                             {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NLogicalOperator>(yystack_[2].value.as < NExpression* > (), yystack_[1].value.as < int > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
 	}
-#line 1746 "semic_grammar.cpp"
+#line 1849 "semic_grammar.cpp"
     break;
 
-  case 31:
-#line 235 "semic.y"
-                                                       {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
-	}
-#line 1756 "semic_grammar.cpp"
+  case 43: // conditional_expression: logical_or_expression
+#line 283 "semic.y"
+                                { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1855 "semic_grammar.cpp"
     break;
 
-  case 32:
-#line 240 "semic.y"
-                                                       {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
+  case 44: // assignment_expression: unary_expression assignment_operator assignment_expression
+#line 288 "semic.y"
+                                                                     {
+		yylhs.value.as < NExpression* > () = unit.arena.make<NAssignment>(yystack_[2].value.as < NExpression* > (), yystack_[0].value.as < NExpression* > ());
+		LOCATE(yylhs.value.as < NExpression* > (), yystack_[1].location);
 	}
-#line 1766 "semic_grammar.cpp"
+#line 1864 "semic_grammar.cpp"
     break;
 
-  case 34:
-#line 249 "semic.y"
-                                                          {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
-	}
-#line 1776 "semic_grammar.cpp"
+  case 45: // assignment_expression: conditional_expression
+#line 292 "semic.y"
+                                 { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1870 "semic_grammar.cpp"
     break;
 
-  case 35:
-#line 254 "semic.y"
-                                                          {
-		(yyval.expr) = new NBinaryOperator(std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-			(yyvsp[-1].token),
-			std::shared_ptr<NExpression>((yyvsp[0].expr)));
-	}
-#line 1786 "semic_grammar.cpp"
+  case 57: // expression: assignment_expression
+#line 310 "semic.y"
+                                { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1876 "semic_grammar.cpp"
     break;
 
-  case 42:
-#line 292 "semic.y"
-                                                                     {
-		(yyval.expr) = new NAssignment(std::shared_ptr<NExpression>((yyvsp[-2].expr)), std::shared_ptr<NExpression>((yyvsp[0].expr)));
-	}
-#line 1794 "semic_grammar.cpp"
+  case 58: // constant_expression: conditional_expression
+#line 315 "semic.y"
+                                 { yylhs.value.as < NExpression* > () = yystack_[0].value.as < NExpression* > (); }
+#line 1882 "semic_grammar.cpp"
     break;
 
-  case 56:
-#line 322 "semic.y"
+  case 59: // declaration: type_specifier init_declarator_list
+#line 319 "semic.y"
                                               {
-		(yyvsp[0].var_list)->set_type((yyvsp[-1].token));
-		(yyval.var_list) = (yyvsp[0].var_list);
+		yystack_[0].value.as < NVariableDeclarationList* > ()->set_type(yystack_[1].value.as < int > ());
+		yylhs.value.as < NVariableDeclarationList* > () = yystack_[0].value.as < NVariableDeclarationList* > ();
 	}
-#line 1803 "semic_grammar.cpp"
+#line 1891 "semic_grammar.cpp"
     break;
 
-  case 57:
-#line 329 "semic.y"
+  case 60: // init_declarator_list: init_declarator
+#line 326 "semic.y"
                           {
-		(yyval.var_list) = new NVariableDeclarationList(std::make_shared<VariableList>());
-		(yyval.var_list)->push_back(std::shared_ptr<NVariableDeclaration>((yyvsp[0].var_decl)));
+		yylhs.value.as < NVariableDeclarationList* > () = unit.arena.make<NVariableDeclarationList>();
+		yylhs.value.as < NVariableDeclarationList* > ()->push_back(yystack_[0].value.as < NVariableDeclaration* > ());
 	}
-#line 1812 "semic_grammar.cpp"
+#line 1900 "semic_grammar.cpp"
     break;
 
-  case 58:
-#line 333 "semic.y"
+  case 61: // init_declarator_list: init_declarator_list ',' init_declarator
+#line 330 "semic.y"
                                                    {
-		(yyvsp[-2].var_list)->push_back(std::shared_ptr<NVariableDeclaration>((yyvsp[0].var_decl)));
+		yylhs.value.as < NVariableDeclarationList* > () = yystack_[2].value.as < NVariableDeclarationList* > ();
+		yylhs.value.as < NVariableDeclarationList* > ()->push_back(yystack_[0].value.as < NVariableDeclaration* > ());
 	}
-#line 1820 "semic_grammar.cpp"
+#line 1909 "semic_grammar.cpp"
     break;
 
-  case 59:
-#line 339 "semic.y"
+  case 62: // init_declarator: declarator '=' conditional_expression
+#line 337 "semic.y"
                                                 {
-		(yyval.var_decl) = new NVariableDeclaration(
+		yylhs.value.as < NVariableDeclaration* > () = unit.arena.make<NVariableDeclaration>(
 			0,
-			std::shared_ptr<NIdentifier>((yyvsp[-2].ident)),
-			std::shared_ptr<NExpression>((yyvsp[0].expr))
+			yystack_[2].value.as < NIdentifier* > (),
+			yystack_[0].value.as < NExpression* > ()
 		); 
 	}
-#line 1832 "semic_grammar.cpp"
+#line 1921 "semic_grammar.cpp"
     break;
 
-  case 60:
-#line 346 "semic.y"
+  case 63: // init_declarator: declarator
+#line 344 "semic.y"
                      {
-		(yyval.var_decl) = new NVariableDeclaration(
+		yylhs.value.as < NVariableDeclaration* > () = unit.arena.make<NVariableDeclaration>(
 			0,
-			std::shared_ptr<NIdentifier>((yyvsp[0].ident))
+			yystack_[0].value.as < NIdentifier* > ()
 		); 
 	}
-#line 1843 "semic_grammar.cpp"
+#line 1932 "semic_grammar.cpp"
     break;
 
-  case 71:
-#line 368 "semic.y"
-                                    { (yyvsp[0].ident)->pointer_level = 1; (yyval.ident) = (yyvsp[0].ident); }
-#line 1849 "semic_grammar.cpp"
+  case 64: // type_specifier: VOID
+#line 353 "semic.y"
+               { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1938 "semic_grammar.cpp"
     break;
 
-  case 73:
-#line 373 "semic.y"
-                     { (yyval.ident) = new NIdentifier(std::shared_ptr<std::string>((yyvsp[0].string))); }
-#line 1855 "semic_grammar.cpp"
+  case 65: // type_specifier: CHAR
+#line 354 "semic.y"
+               { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1944 "semic_grammar.cpp"
+    break;
+
+  case 66: // type_specifier: SHORT
+#line 355 "semic.y"
+                { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1950 "semic_grammar.cpp"
+    break;
+
+  case 67: // type_specifier: INT
+#line 356 "semic.y"
+              { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1956 "semic_grammar.cpp"
+    break;
+
+  case 68: // type_specifier: LONG
+#line 357 "semic.y"
+               { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1962 "semic_grammar.cpp"
+    break;
+
+  case 69: // type_specifier: FLOAT
+#line 358 "semic.y"
+                { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1968 "semic_grammar.cpp"
+    break;
+
+  case 70: // type_specifier: DOUBLE
+#line 359 "semic.y"
+                 { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1974 "semic_grammar.cpp"
+    break;
+
+  case 71: // type_specifier: SIGNED
+#line 360 "semic.y"
+                 { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1980 "semic_grammar.cpp"
+    break;
+
+  case 72: // type_specifier: UNSIGNED
+#line 361 "semic.y"
+                   { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1986 "semic_grammar.cpp"
+    break;
+
+  case 73: // type_specifier: TYPE_NAME
+#line 362 "semic.y"
+                    { yylhs.value.as < int > () = yystack_[0].value.as < int > (); }
+#line 1992 "semic_grammar.cpp"
+    break;
+
+  case 74: // declarator: pointer direct_declarator
+#line 366 "semic.y"
+                                    { yystack_[0].value.as < NIdentifier* > ()->pointer_level = 1; yylhs.value.as < NIdentifier* > () = yystack_[0].value.as < NIdentifier* > (); }
+#line 1998 "semic_grammar.cpp"
+    break;
+
+  case 75: // declarator: direct_declarator
+#line 367 "semic.y"
+                            { yylhs.value.as < NIdentifier* > () = yystack_[0].value.as < NIdentifier* > (); }
+#line 2004 "semic_grammar.cpp"
+    break;
+
+  case 76: // direct_declarator: IDENTIFIER
+#line 371 "semic.y"
+                     { yylhs.value.as < NIdentifier* > () = unit.arena.make<NIdentifier>(yystack_[0].value.as < Symbol > ()); LOCATE(yylhs.value.as < NIdentifier* > (), yystack_[0].location); }
+#line 2010 "semic_grammar.cpp"
     break;
 
-  case 74:
-#line 375 "semic.y"
+  case 77: // direct_declarator: direct_declarator '[' CONSTANT ']'
+#line 373 "semic.y"
                                              {
-        (yyvsp[-3].ident)->array_size = std::stoi(*(yyvsp[-1].string));
-        delete (yyvsp[-1].string);
+        yystack_[3].value.as < NIdentifier* > ()->array_size = static_cast<int>(parse_integer(yystack_[1].value.as < std::string_view > ()));
+        yylhs.value.as < NIdentifier* > () = yystack_[3].value.as < NIdentifier* > ();
 	}
-#line 1864 "semic_grammar.cpp"
+#line 2019 "semic_grammar.cpp"
     break;
 
-  case 75:
-#line 383 "semic.y"
-                 { (yyval.pointer_level) = 0; }
-#line 1870 "semic_grammar.cpp"
+  case 78: // pointer: MUL_OP
+#line 381 "semic.y"
+                 { yylhs.value.as < int > () = 0; }
+#line 2025 "semic_grammar.cpp"
     break;
 
-  case 76:
-#line 384 "semic.y"
-                         { (yyval.pointer_level) = (yyvsp[0].pointer_level) + 1; }
-#line 1876 "semic_grammar.cpp"
+  case 79: // pointer: MUL_OP pointer
+#line 382 "semic.y"
+                         { yylhs.value.as < int > () = yystack_[0].value.as < int > () + 1; }
+#line 2031 "semic_grammar.cpp"
     break;
 
-  case 77:
-#line 388 "semic.y"
+  case 80: // func_declarator: IDENTIFIER '(' parameter_list ')'
+#line 386 "semic.y"
                                             {
-		(yyval.func_decl) = new NFunctionDeclaration(
-			std::make_shared<NIdentifier>(
-				std::shared_ptr<std::string>((yyvsp[-3].string))
-			),
-			std::shared_ptr<NVariableDeclarationList>((yyvsp[-1].var_list))
+		yylhs.value.as < NFunctionDeclaration* > () = unit.arena.make<NFunctionDeclaration>(
+			unit.arena.make<NIdentifier>(yystack_[3].value.as < Symbol > ()),
+			yystack_[1].value.as < NVariableDeclarationList* > ()
 		);
 	}
-#line 1889 "semic_grammar.cpp"
+#line 2042 "semic_grammar.cpp"
     break;
 
-  case 78:
-#line 401 "semic.y"
+  case 81: // parameter_list: parameter_declaration
+#line 397 "semic.y"
                                 {
-		(yyval.var_list) = new NVariableDeclarationList(std::make_shared<VariableList>());
-		(yyval.var_list)->push_back(std::shared_ptr<NVariableDeclaration>((yyvsp[0].var_decl)));
+		yylhs.value.as < NVariableDeclarationList* > () = unit.arena.make<NVariableDeclarationList>();
+		yylhs.value.as < NVariableDeclarationList* > ()->push_back(yystack_[0].value.as < NVariableDeclaration* > ());
 	}
-#line 1898 "semic_grammar.cpp"
+#line 2051 "semic_grammar.cpp"
     break;
 
-  case 79:
-#line 405 "semic.y"
+  case 82: // parameter_list: parameter_list ',' parameter_declaration
+#line 401 "semic.y"
                                                    {
-		(yyvsp[-2].var_list)->push_back(std::shared_ptr<NVariableDeclaration>((yyvsp[0].var_decl)));
+		yylhs.value.as < NVariableDeclarationList* > () = yystack_[2].value.as < NVariableDeclarationList* > ();
+		yylhs.value.as < NVariableDeclarationList* > ()->push_back(yystack_[0].value.as < NVariableDeclaration* > ());
 	}
-#line 1906 "semic_grammar.cpp"
+#line 2060 "semic_grammar.cpp"
     break;
 
-  case 80:
-#line 410 "semic.y"
+  case 83: // parameter_declaration: type_specifier
+#line 407 "semic.y"
                          {
-        (yyval.var_decl) = new NVariableDeclaration((yyvsp[0].token), std::shared_ptr<NIdentifier>(nullptr));
+        yylhs.value.as < NVariableDeclaration* > () = unit.arena.make<NVariableDeclaration>(yystack_[0].value.as < int > (), nullptr);
     }
-#line 1914 "semic_grammar.cpp"
+#line 2068 "semic_grammar.cpp"
     break;
 
-  case 81:
-#line 413 "semic.y"
+  case 84: // parameter_declaration: type_specifier declarator
+#line 410 "semic.y"
                                     {
-        (yyval.var_decl) = new NVariableDeclaration((yyvsp[-1].token), std::shared_ptr<NIdentifier>((yyvsp[0].ident)));
+        yylhs.value.as < NVariableDeclaration* > () = unit.arena.make<NVariableDeclaration>(yystack_[1].value.as < int > (), yystack_[0].value.as < NIdentifier* > ());
     }
-#line 1922 "semic_grammar.cpp"
+#line 2076 "semic_grammar.cpp"
     break;
 
-  case 82:
-#line 424 "semic.y"
+  case 85: // declaration_statement: declaration ';'
+#line 421 "semic.y"
                       {
-			(yyval.stmt) = (yyvsp[-1].stmt);
+			yylhs.value.as < NStatement* > () = yystack_[1].value.as < NVariableDeclarationList* > ();
 		}
-#line 1930 "semic_grammar.cpp"
+#line 2084 "semic_grammar.cpp"
     break;
 
-  case 83:
-#line 430 "semic.y"
-                         { (yyval.stmt) = new NExpressionStatement(std::shared_ptr<NExpression>((yyvsp[-1].expr))); }
-#line 1936 "semic_grammar.cpp"
+  case 86: // expression_statement: expression ';'
+#line 427 "semic.y"
+                         { yylhs.value.as < NStatement* > () = unit.arena.make<NExpressionStatement>(yystack_[1].value.as < NExpression* > ()); LOCATE(yylhs.value.as < NStatement* > (), yystack_[1].location); }
+#line 2090 "semic_grammar.cpp"
     break;
 
-  case 84:
-#line 435 "semic.y"
+  case 87: // selection_statement: IF '(' expression ')' compound_statement
+#line 432 "semic.y"
                                                    {
-        (yyval.stmt) = new NIfStatement(
-            std::shared_ptr<NExpression>((yyvsp[-2].expr)),
-            std::shared_ptr<NBlock>((yyvsp[0].block))
+        yylhs.value.as < NStatement* > () = unit.arena.make<NIfStatement>(
+            yystack_[2].value.as < NExpression* > (),
+            yystack_[0].value.as < NBlock* > ()
         );
+        LOCATE(yylhs.value.as < NStatement* > (), yystack_[4].location);
+    }
+#line 2102 "semic_grammar.cpp"
+    break;
+
+  case 88: // selection_statement: SWITCH '(' expression ')' '{' switch_clause_list '}'
+#line 442 "semic.y"
+                                                               {
+        yystack_[1].value.as < NSwitchStatement* > ()->condition = yystack_[4].value.as < NExpression* > ();
+        yylhs.value.as < NStatement* > () = yystack_[1].value.as < NSwitchStatement* > ();
+        LOCATE(yylhs.value.as < NStatement* > (), yystack_[6].location);
+    }
+#line 2112 "semic_grammar.cpp"
+    break;
+
+  case 89: // switch_clause_list: switch_clause
+#line 450 "semic.y"
+                        {
+        yylhs.value.as < NSwitchStatement* > () = unit.arena.make<NSwitchStatement>();
+        yylhs.value.as < NSwitchStatement* > ()->push_back(yystack_[0].value.as < NCaseClause* > ());
+    }
+#line 2121 "semic_grammar.cpp"
+    break;
+
+  case 90: // switch_clause_list: switch_clause_list switch_clause
+#line 454 "semic.y"
+                                           {
+        yylhs.value.as < NSwitchStatement* > () = yystack_[1].value.as < NSwitchStatement* > ();
+        yylhs.value.as < NSwitchStatement* > ()->push_back(yystack_[0].value.as < NCaseClause* > ());
+    }
+#line 2130 "semic_grammar.cpp"
+    break;
+
+  case 91: // switch_clause: CASE constant_expression ':'
+#line 461 "semic.y"
+                                       {
+        yylhs.value.as < NCaseClause* > () = unit.arena.make<NCaseClause>(yystack_[1].value.as < NExpression* > (), unit.arena.make<NBlock>());
+        LOCATE(yylhs.value.as < NCaseClause* > (), yystack_[2].location);
+    }
+#line 2139 "semic_grammar.cpp"
+    break;
+
+  case 92: // switch_clause: CASE constant_expression ':' statement_list
+#line 465 "semic.y"
+                                                      {
+        yylhs.value.as < NCaseClause* > () = unit.arena.make<NCaseClause>(yystack_[2].value.as < NExpression* > (), yystack_[0].value.as < NBlock* > ());
+        LOCATE(yylhs.value.as < NCaseClause* > (), yystack_[3].location);
+    }
+#line 2148 "semic_grammar.cpp"
+    break;
+
+  case 93: // switch_clause: DEFAULT ':'
+#line 469 "semic.y"
+                      {
+        yylhs.value.as < NCaseClause* > () = unit.arena.make<NCaseClause>(nullptr, unit.arena.make<NBlock>());
+        LOCATE(yylhs.value.as < NCaseClause* > (), yystack_[1].location);
+    }
+#line 2157 "semic_grammar.cpp"
+    break;
+
+  case 94: // switch_clause: DEFAULT ':' statement_list
+#line 473 "semic.y"
+                                     {
+        yylhs.value.as < NCaseClause* > () = unit.arena.make<NCaseClause>(nullptr, yystack_[0].value.as < NBlock* > ());
+        LOCATE(yylhs.value.as < NCaseClause* > (), yystack_[2].location);
     }
-#line 1947 "semic_grammar.cpp"
+#line 2166 "semic_grammar.cpp"
     break;
 
-  case 85:
-#line 447 "semic.y"
+  case 95: // iteration_statement: FOR '(' expression ';' expression ';' ')' compound_statement
+#line 480 "semic.y"
                                                                        {
-        (yyval.stmt) = new NForStatement(
-            std::shared_ptr<NBlock>((yyvsp[0].block)),
-            std::shared_ptr<NExpression>((yyvsp[-5].expr)),
-            std::shared_ptr<NExpression>((yyvsp[-3].expr))
+        yylhs.value.as < NStatement* > () = unit.arena.make<NForStatement>(
+            yystack_[0].value.as < NBlock* > (),
+            yystack_[5].value.as < NExpression* > (),
+            yystack_[3].value.as < NExpression* > ()
         );
+        LOCATE(yylhs.value.as < NStatement* > (), yystack_[7].location);
     }
-#line 1959 "semic_grammar.cpp"
+#line 2179 "semic_grammar.cpp"
     break;
 
-  case 86:
-#line 454 "semic.y"
+  case 96: // iteration_statement: FOR '(' expression ';' expression ';' expression ')' compound_statement
+#line 488 "semic.y"
                                                                                   {
-        (yyval.stmt) = new NForStatement(
-            std::shared_ptr<NBlock>((yyvsp[0].block)),
-            std::shared_ptr<NExpression>((yyvsp[-6].expr)),
-            std::shared_ptr<NExpression>((yyvsp[-4].expr)),
-            std::shared_ptr<NExpression>((yyvsp[-2].expr))
+        yylhs.value.as < NStatement* > () = unit.arena.make<NForStatement>(
+            yystack_[0].value.as < NBlock* > (),
+            yystack_[6].value.as < NExpression* > (),
+            yystack_[4].value.as < NExpression* > (),
+            yystack_[2].value.as < NExpression* > ()
+        );
+        LOCATE(yylhs.value.as < NStatement* > (), yystack_[8].location);
+    }
+#line 2193 "semic_grammar.cpp"
+    break;
+
+  case 97: // iteration_statement: WHILE '(' expression ')' compound_statement
+#line 497 "semic.y"
+                                                      {
+        yylhs.value.as < NStatement* > () = unit.arena.make<NWhileStatement>(
+            yystack_[2].value.as < NExpression* > (),
+            yystack_[0].value.as < NBlock* > ()
+        );
+        LOCATE(yylhs.value.as < NStatement* > (), yystack_[4].location);
+    }
+#line 2205 "semic_grammar.cpp"
+    break;
+
+  case 98: // iteration_statement: DO compound_statement WHILE '(' expression ')' ';'
+#line 504 "semic.y"
+                                                             {
+        yylhs.value.as < NStatement* > () = unit.arena.make<NWhileStatement>(
+            yystack_[2].value.as < NExpression* > (),
+            yystack_[5].value.as < NBlock* > (),
+            false
         );
+        LOCATE(yylhs.value.as < NStatement* > (), yystack_[6].location);
     }
-#line 1972 "semic_grammar.cpp"
+#line 2218 "semic_grammar.cpp"
     break;
 
-  case 87:
-#line 467 "semic.y"
+  case 99: // jump_statement: RETURN expression ';'
+#line 515 "semic.y"
                                 {
-        (yyval.stmt) = new NReturnStatement(
-            std::shared_ptr<NExpression>((yyvsp[-1].expr))
+        yylhs.value.as < NStatement* > () = unit.arena.make<NReturnStatement>(
+            yystack_[1].value.as < NExpression* > ()
         );
+        LOCATE(yylhs.value.as < NStatement* > (), yystack_[2].location);
+    }
+#line 2229 "semic_grammar.cpp"
+    break;
+
+  case 100: // jump_statement: BREAK ';'
+#line 522 "semic.y"
+                    {
+        yylhs.value.as < NStatement* > () = unit.arena.make<NBreakStatement>();
+        LOCATE(yylhs.value.as < NStatement* > (), yystack_[1].location);
     }
-#line 1982 "semic_grammar.cpp"
+#line 2238 "semic_grammar.cpp"
+    break;
+
+  case 101: // statement: declaration_statement
+#line 531 "semic.y"
+                                { yylhs.value.as < NStatement* > () = yystack_[0].value.as < NStatement* > (); }
+#line 2244 "semic_grammar.cpp"
+    break;
+
+  case 102: // statement: expression_statement
+#line 532 "semic.y"
+                               { yylhs.value.as < NStatement* > () = yystack_[0].value.as < NStatement* > (); }
+#line 2250 "semic_grammar.cpp"
+    break;
+
+  case 103: // statement: selection_statement
+#line 533 "semic.y"
+                              { yylhs.value.as < NStatement* > () = yystack_[0].value.as < NStatement* > (); }
+#line 2256 "semic_grammar.cpp"
+    break;
+
+  case 104: // statement: iteration_statement
+#line 534 "semic.y"
+                              { yylhs.value.as < NStatement* > () = yystack_[0].value.as < NStatement* > (); }
+#line 2262 "semic_grammar.cpp"
     break;
 
-  case 93:
-#line 487 "semic.y"
+  case 105: // statement: jump_statement
+#line 535 "semic.y"
+                         { yylhs.value.as < NStatement* > () = yystack_[0].value.as < NStatement* > (); }
+#line 2268 "semic_grammar.cpp"
+    break;
+
+  case 106: // statement_list: statement
+#line 539 "semic.y"
                     {
-        (yyval.block) = new NBlock();
-        (yyval.block)->push_back(std::shared_ptr<NStatement>((yyvsp[0].stmt)));
+        yylhs.value.as < NBlock* > () = unit.arena.make<NBlock>();
+        yylhs.value.as < NBlock* > ()->push_back(yystack_[0].value.as < NStatement* > ());
     }
-#line 1991 "semic_grammar.cpp"
+#line 2277 "semic_grammar.cpp"
     break;
 
-  case 94:
-#line 491 "semic.y"
+  case 107: // statement_list: statement_list statement
+#line 543 "semic.y"
                                    {
-        (yyvsp[-1].block)->push_back(std::shared_ptr<NStatement>((yyvsp[0].stmt)));
+        yylhs.value.as < NBlock* > () = yystack_[1].value.as < NBlock* > ();
+        yylhs.value.as < NBlock* > ()->push_back(yystack_[0].value.as < NStatement* > ());
     }
-#line 1999 "semic_grammar.cpp"
+#line 2286 "semic_grammar.cpp"
     break;
 
-  case 95:
-#line 497 "semic.y"
-                  { (yyval.block) = new NBlock(); }
-#line 2005 "semic_grammar.cpp"
+  case 108: // compound_statement: '{' '}'
+#line 550 "semic.y"
+                  { yylhs.value.as < NBlock* > () = unit.arena.make<NBlock>(); }
+#line 2292 "semic_grammar.cpp"
     break;
 
-  case 96:
-#line 498 "semic.y"
-                                 { (yyval.block) = (yyvsp[-1].block); }
-#line 2011 "semic_grammar.cpp"
+  case 109: // compound_statement: '{' statement_list '}'
+#line 551 "semic.y"
+                                 { yylhs.value.as < NBlock* > () = yystack_[1].value.as < NBlock* > (); }
+#line 2298 "semic_grammar.cpp"
     break;
 
-  case 97:
-#line 504 "semic.y"
-                              { programBlocks.push_back(std::shared_ptr<NFunction>((yyvsp[0].func))); }
-#line 2017 "semic_grammar.cpp"
+  case 110: // translation_unit: function_definition
+#line 557 "semic.y"
+                              { unit.functions.push_back(yystack_[0].value.as < NFunction* > ()); }
+#line 2304 "semic_grammar.cpp"
     break;
 
-  case 98:
-#line 505 "semic.y"
-                                               { programBlocks.push_back(std::shared_ptr<NFunction>((yyvsp[0].func))); }
-#line 2023 "semic_grammar.cpp"
+  case 111: // translation_unit: translation_unit function_definition
+#line 558 "semic.y"
+                                               { unit.functions.push_back(yystack_[0].value.as < NFunction* > ()); }
+#line 2310 "semic_grammar.cpp"
     break;
 
-  case 99:
-#line 509 "semic.y"
+  case 112: // function_definition: type_specifier func_declarator compound_statement
+#line 562 "semic.y"
                                                             {
-        (yyval.func) = new NFunction((yyvsp[-2].token),
-        std::shared_ptr<NFunctionDeclaration>((yyvsp[-1].func_decl)),
-        std::shared_ptr<NBlock>((yyvsp[0].block)));
+        yylhs.value.as < NFunction* > () = unit.arena.make<NFunction>(yystack_[2].value.as < int > (),
+        yystack_[1].value.as < NFunctionDeclaration* > (),
+        yystack_[0].value.as < NBlock* > ());
+        LOCATE(yylhs.value.as < NFunction* > (), yystack_[1].location);
     }
-#line 2033 "semic_grammar.cpp"
+#line 2321 "semic_grammar.cpp"
     break;
 
 
-#line 2037 "semic_grammar.cpp"
+#line 2325 "semic_grammar.cpp"
+
+            default:
+              break;
+            }
+        }
+#if YY_EXCEPTIONS
+      catch (const syntax_error& yyexc)
+        {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+          error (yyexc);
+          YYERROR;
+        }
+#endif // YY_EXCEPTIONS
+      YY_SYMBOL_PRINT ("-> $$ =", yylhs);
+      yypop_ (yylen);
+      yylen = 0;
 
-      default: break;
+      // Shift the result of the reduction.
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
-  /* User semantic actions sometimes alter yychar, and that requires
-     that yytoken be updated with the new translation.  We take the
-     approach of translating immediately before every use of yytoken.
-     One alternative is translating here after every semantic action,
-     but that translation would be missed if the semantic action invokes
-     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
-     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
-     incorrect destructor might then be invoked immediately.  In the
-     case of YYERROR or YYBACKUP, subsequent parser actions might lead
-     to an incorrect destructor call or verbose syntax error message
-     before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
-
-  YYPOPSTACK (yylen);
-  yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
-
-  *++yyvsp = yyval;
-
-  /* Now 'shift' the result of the reduction.  Determine what state
-     that goes to, based on the state we popped back to and the rule
-     number reduced by.  */
-  {
-    const int yylhs = yyr1[yyn] - YYNTOKENS;
-    const int yyi = yypgoto[yylhs] + *yyssp;
-    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
-               ? yytable[yyi]
-               : yydefgoto[yylhs]);
-  }
+    goto yynewstate;
 
-  goto yynewstate;
 
+  /*--------------------------------------.
+  | yyerrlab -- here on detecting error.  |
+  `--------------------------------------*/
+  yyerrlab:
+    // If not already recovering from an error, report this error.
+    if (!yyerrstatus_)
+      {
+        ++yynerrs_;
+        std::string msg = YY_("syntax error");
+        error (yyla.location, YY_MOVE (msg));
+      }
 
-/*--------------------------------------.
-| yyerrlab -- here on detecting error.  |
-`--------------------------------------*/
-yyerrlab:
-  /* Make sure we have latest lookahead translation.  See comments at
-     user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
 
-  /* If not already recovering from an error, report this error.  */
-  if (!yyerrstatus)
-    {
-      ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
+    yyerror_range[1].location = yyla.location;
+    if (yyerrstatus_ == 3)
+      {
+        /* If just tried and failed to reuse lookahead token after an
+           error, discard it.  */
+
+        // Return failure if at end of input.
+        if (yyla.kind () == symbol_kind::S_YYEOF)
+          YYABORT;
+        else if (!yyla.empty ())
+          {
+            yy_destroy_ ("Error: discarding", yyla);
+            yyla.clear ();
+          }
+      }
+
+    // Else will try to reuse lookahead token after shifting the error token.
+    goto yyerrlab1;
+
+
+  /*---------------------------------------------------.
+  | yyerrorlab -- error raised explicitly by YYERROR.  |
+  `---------------------------------------------------*/
+  yyerrorlab:
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
+    if (false)
+      YYERROR;
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYERROR.  */
+    yypop_ (yylen);
+    yylen = 0;
+    YY_STACK_PRINT ();
+    goto yyerrlab1;
+
+
+  /*-------------------------------------------------------------.
+  | yyerrlab1 -- common code for both syntax error and YYERROR.  |
+  `-------------------------------------------------------------*/
+  yyerrlab1:
+    yyerrstatus_ = 3;   // Each real token shifted decrements this.
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
       {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
           {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = YY_CAST (char *, YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
               }
           }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
+
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
       }
-# undef YYSYNTAX_ERROR
-#endif
+    {
+      stack_symbol_type error_token;
+
+      yyerror_range[2].location = yyla.location;
+      YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
+
+      // Shift the error token.
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
+    goto yynewstate;
 
 
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
+  yyacceptlab:
+    yyresult = 0;
+    goto yyreturn;
 
-  if (yyerrstatus == 3)
-    {
-      /* If just tried and failed to reuse lookahead token after an
-         error, discard it.  */
 
-      if (yychar <= YYEOF)
-        {
-          /* Return failure if at end of input.  */
-          if (yychar == YYEOF)
-            YYABORT;
-        }
-      else
-        {
-          yydestruct ("Error: discarding",
-                      yytoken, &yylval);
-          yychar = YYEMPTY;
-        }
-    }
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
+  yyabortlab:
+    yyresult = 1;
+    goto yyreturn;
 
-  /* Else will try to reuse lookahead token after shifting the error
-     token.  */
-  goto yyerrlab1;
 
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
+  yyreturn:
+    if (!yyla.empty ())
+      yy_destroy_ ("Cleanup: discarding lookahead", yyla);
 
-/*---------------------------------------------------.
-| yyerrorlab -- error raised explicitly by YYERROR.  |
-`---------------------------------------------------*/
-yyerrorlab:
-  /* Pacify compilers when the user code never invokes YYERROR and the
-     label yyerrorlab therefore never appears in user code.  */
-  if (0)
-    YYERROR;
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYABORT or YYACCEPT.  */
+    yypop_ (yylen);
+    YY_STACK_PRINT ();
+    while (1 < yystack_.size ())
+      {
+        yy_destroy_ ("Cleanup: popping", yystack_[0]);
+        yypop_ ();
+      }
 
-  /* Do not reclaim the symbols of the rule whose action triggered
-     this YYERROR.  */
-  YYPOPSTACK (yylen);
-  yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
-  yystate = *yyssp;
-  goto yyerrlab1;
+    return yyresult;
+  }
+#if YY_EXCEPTIONS
+    catch (...)
+      {
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
+        // Do not try to display the values of the reclaimed symbols,
+        // as their printers might throw an exception.
+        if (!yyla.empty ())
+          yy_destroy_ (YY_NULLPTR, yyla);
+
+        while (1 < yystack_.size ())
+          {
+            yy_destroy_ (YY_NULLPTR, yystack_[0]);
+            yypop_ ();
+          }
+        throw;
+      }
+#endif // YY_EXCEPTIONS
+  }
+
+  void
+  parser::error (const syntax_error& yyexc)
+  {
+    error (yyexc.location, yyexc.what ());
+  }
+
+#if YYDEBUG || 0
+  const char *
+  parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytname_[yysymbol];
+  }
+#endif // #if YYDEBUG || 0
 
 
-/*-------------------------------------------------------------.
-| yyerrlab1 -- common code for both syntax error and YYERROR.  |
-`-------------------------------------------------------------*/
-yyerrlab1:
-  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
-  for (;;)
-    {
-      yyn = yypact[yystate];
-      if (!yypact_value_is_default (yyn))
-        {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-            {
-              yyn = yytable[yyn];
-              if (0 < yyn)
-                break;
-            }
-        }
 
-      /* Pop the current state because it cannot handle the error token.  */
-      if (yyssp == yyss)
-        YYABORT;
 
 
-      yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
-      YYPOPSTACK (1);
-      yystate = *yyssp;
-      YY_STACK_PRINT (yyss, yyssp);
-    }
 
-  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  *++yyvsp = yylval;
-  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
-  /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  const short parser::yypact_ninf_ = -157;
+
+  const signed char parser::yytable_ninf_ = -1;
+
+  const short
+  parser::yypact_[] =
+  {
+     236,  -157,  -157,  -157,  -157,  -157,  -157,  -157,  -157,  -157,
+    -157,    21,   219,  -157,   -27,   -16,  -157,  -157,   236,    60,
+    -157,     7,   -33,  -157,     5,  -157,  -157,    13,    13,    30,
+      32,    36,   -16,    48,    45,    13,    13,  -157,  -157,     0,
+     186,  -157,     9,   -15,    26,    -1,    43,  -157,  -157,  -157,
+      90,    96,  -157,  -157,    51,    55,     7,  -157,  -157,  -157,
+    -157,  -157,  -157,   131,  -157,    88,  -157,    61,   118,  -157,
+     236,   144,  -157,  -157,    13,    13,    13,    72,    13,  -157,
+      68,    65,  -157,  -157,    13,  -157,  -157,  -157,  -157,  -157,
+    -157,  -157,  -157,  -157,  -157,  -157,    13,    13,    13,    13,
+      13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+      13,    13,  -157,  -157,    71,  -157,    75,  -157,  -157,  -157,
+     134,    61,  -157,  -157,   -26,  -157,    83,    84,    85,    87,
+      91,  -157,  -157,    95,  -157,  -157,  -157,  -157,  -157,     9,
+       9,   -15,   -15,    26,    26,    26,    26,    -1,    -1,  -157,
+      90,     7,    13,    97,  -157,    13,   -16,    86,   -16,    13,
+      13,  -157,  -157,  -157,  -157,  -157,  -157,    15,  -157,   100,
+     101,    13,   110,   -19,  -157,   114,   157,  -157,   113,   189,
+    -157,  -157,  -157,   -16,   105,   189,   189,  -157,   -16,   189,
+    -157
+  };
+
+  const signed char
+  parser::yydefact_[] =
+  {
+       0,    73,    65,    66,    67,    68,    71,    72,    69,    70,
+      64,     0,     0,   110,     0,     0,     1,   111,     0,     0,
+     112,    83,     0,    81,     2,     3,     5,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   108,     6,    14,
+      17,    21,    22,    25,    28,    33,    36,    37,    38,    39,
+      41,    43,    45,    57,     0,     0,     0,   101,   102,   103,
+     104,   105,   106,     0,    76,    78,    84,    75,     0,    80,
+       0,     0,    15,    16,     0,     0,     0,     0,     0,   100,
+       0,     0,    10,    11,     0,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    86,    85,    59,    60,    63,   109,   107,    79,
+       0,    74,    82,     8,     0,    12,     0,     0,     0,     0,
+       0,    99,     4,     0,    44,    17,    18,    19,    20,    24,
+      23,    26,    27,    31,    32,    29,    30,    34,    35,    40,
+      42,     0,     0,     0,     9,     0,     0,     0,     0,     0,
+       0,     7,    61,    62,    77,    13,    87,     0,    97,     0,
+       0,     0,     0,     0,    89,     0,     0,    58,     0,    93,
+      88,    90,    98,     0,     0,    91,    94,    95,     0,    92,
+      96
+  };
+
+  const short
+  parser::yypgoto_[] =
+  {
+    -157,  -157,  -157,  -157,   -25,   -43,   -34,   -11,   -55,   -14,
+    -157,  -157,  -157,    74,    78,  -157,  -132,   -65,  -157,   -31,
+    -157,  -157,  -157,    34,     1,   169,   123,   130,  -157,  -157,
+     129,  -157,  -157,  -157,  -157,    27,  -157,  -157,   -56,  -156,
+     -32,  -157,   191
+  };
+
+  const unsigned char
+  parser::yydefgoto_[] =
+  {
+       0,    38,    39,   124,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    96,    54,
+     178,    55,   114,   115,    56,   116,    67,    68,    15,    22,
+      23,    57,    58,    59,   173,   174,    60,    61,    62,    63,
+      20,    12,    13
+  };
 
-  yystate = yyn;
-  goto yynewstate;
+  const unsigned char
+  parser::yytable_[] =
+  {
+      77,    11,    72,    73,    80,    81,   125,   118,    82,    83,
+      64,   104,   105,    11,   100,   101,    24,    25,    26,    21,
+     163,    27,    28,   186,    14,    69,   171,   172,    70,   189,
+      18,   134,   154,   106,   107,   155,   102,   103,    65,   177,
+      97,    98,    99,   126,   127,   128,   180,   130,    19,   143,
+     144,   145,   146,   133,   136,   137,   138,   108,   109,    84,
+     171,   172,    71,    24,    25,    26,   139,   140,    27,    28,
+      36,    21,   135,   135,   135,   135,   135,   135,   135,   135,
+     135,   135,   135,   135,   135,   135,   135,    74,     1,    75,
+     165,   141,   142,    76,   147,   148,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    78,   110,    29,    79,    30,
+      31,    32,    33,   111,   112,    34,    35,    36,   113,    65,
+     120,    64,   129,   132,   166,    37,   168,   135,   169,   170,
+     118,   131,   151,   118,    24,    25,    26,   152,   153,    27,
+      28,   156,   157,   158,   159,   184,   135,    24,    25,    26,
+     167,   187,    27,    28,   160,   161,   190,   164,   175,     1,
+      24,    25,    26,   188,   176,    27,    28,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,   179,   182,    29,   185,
+      30,    31,    32,    33,   149,   162,    34,    35,    36,   150,
+      66,   121,    24,    25,    26,   119,   117,    27,    28,   122,
+     181,    36,   123,    17,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    36,   183,     0,     1,     0,    16,
+       0,     0,     0,     0,     0,     2,     3,     4,     5,     6,
+       7,     8,     9,    10,     0,     0,    29,     0,    30,    31,
+      32,    33,     0,     0,    34,    35,    36,     1,    95,     0,
+       0,     0,     0,     0,     0,     2,     3,     4,     5,     6,
+       7,     8,     9,    10,     1,     0,     0,     0,     0,     0,
+       0,     0,     2,     3,     4,     5,     6,     7,     8,     9,
+      10
+  };
 
+  const short
+  parser::yycheck_[] =
+  {
+      32,     0,    27,    28,    35,    36,    71,    63,     8,     9,
+       3,    12,    13,    12,    29,    30,     3,     4,     5,    18,
+     152,     8,     9,   179,     3,    58,    45,    46,    61,   185,
+      57,    96,    58,    34,    35,    61,    10,    11,    31,   171,
+      31,    32,    33,    74,    75,    76,    65,    78,    64,   104,
+     105,   106,   107,    84,    97,    98,    99,    14,    15,    59,
+      45,    46,    57,     3,     4,     5,   100,   101,     8,     9,
+      57,    70,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,    57,    28,    57,
+     155,   102,   103,    57,   108,   109,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    57,    16,    47,    63,    49,
+      50,    51,    52,    17,    63,    55,    56,    57,    63,    31,
+      59,     3,    50,    58,   156,    65,   158,   152,   159,   160,
+     186,    63,    61,   189,     3,     4,     5,    62,     4,     8,
+       9,    58,    58,    58,    57,   176,   171,     3,     4,     5,
+      64,   183,     8,     9,    63,    60,   188,    60,    58,    28,
+       3,     4,     5,    58,    63,     8,     9,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    66,    63,    47,    66,
+      49,    50,    51,    52,   110,   151,    55,    56,    57,   111,
+      21,    68,     3,     4,     5,    65,    65,     8,     9,    70,
+     173,    57,    58,    12,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    57,    58,    -1,    28,    -1,     0,
+      -1,    -1,    -1,    -1,    -1,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    -1,    -1,    47,    -1,    49,    50,
+      51,    52,    -1,    -1,    55,    56,    57,    28,    62,    -1,
+      -1,    -1,    -1,    -1,    -1,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    28,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    36,    37,    38,    39,    40,    41,    42,    43,
+      44
+  };
 
-/*-------------------------------------.
-| yyacceptlab -- YYACCEPT comes here.  |
-`-------------------------------------*/
-yyacceptlab:
-  yyresult = 0;
-  goto yyreturn;
+  const signed char
+  parser::yystos_[] =
+  {
+       0,    28,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    91,   108,   109,     3,    95,     0,   109,    57,    64,
+     107,    91,    96,    97,     3,     4,     5,     8,     9,    47,
+      49,    50,    51,    52,    55,    56,    57,    65,    68,    69,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    86,    88,    91,    98,    99,   100,
+     103,   104,   105,   106,     3,    31,    92,    93,    94,    58,
+      61,    57,    71,    71,    57,    57,    57,   107,    57,    63,
+      86,    86,     8,     9,    59,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    62,    85,    31,    32,    33,
+      29,    30,    10,    11,    12,    13,    34,    35,    14,    15,
+      16,    17,    63,    63,    89,    90,    92,    65,   105,    94,
+      59,    93,    97,    58,    70,    84,    86,    86,    86,    50,
+      86,    63,    58,    86,    84,    71,    72,    72,    72,    73,
+      73,    74,    74,    75,    75,    75,    75,    76,    76,    80,
+      81,    61,    62,     4,    58,    61,    58,    58,    58,    57,
+      63,    60,    90,    83,    60,    84,   107,    64,   107,    86,
+      86,    45,    46,   101,   102,    58,    63,    83,    87,    66,
+      65,   102,    63,    58,    86,    66,   106,   107,    58,   106,
+     107
+  };
 
+  const signed char
+  parser::yyr1_[] =
+  {
+       0,    67,    68,    68,    68,    68,    69,    69,    69,    69,
+      69,    69,    70,    70,    71,    71,    71,    72,    73,    73,
+      73,    73,    74,    74,    74,    75,    75,    75,    76,    76,
+      76,    76,    76,    77,    77,    77,    78,    79,    80,    81,
+      81,    82,    82,    83,    84,    84,    85,    85,    85,    85,
+      85,    85,    85,    85,    85,    85,    85,    86,    87,    88,
+      89,    89,    90,    90,    91,    91,    91,    91,    91,    91,
+      91,    91,    91,    91,    92,    92,    93,    93,    94,    94,
+      95,    96,    96,    97,    97,    98,    99,   100,   100,   101,
+     101,   102,   102,   102,   102,   103,   103,   103,   103,   104,
+     104,   105,   105,   105,   105,   105,   106,   106,   107,   107,
+     108,   108,   109
+  };
 
-/*-----------------------------------.
-| yyabortlab -- YYABORT comes here.  |
-`-----------------------------------*/
-yyabortlab:
-  yyresult = 1;
-  goto yyreturn;
+  const signed char
+  parser::yyr2_[] =
+  {
+       0,     2,     1,     1,     3,     1,     1,     4,     3,     4,
+       2,     2,     1,     3,     1,     2,     2,     1,     3,     3,
+       3,     1,     1,     3,     3,     1,     3,     3,     1,     3,
+       3,     3,     3,     1,     3,     3,     1,     1,     1,     1,
+       3,     1,     3,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       1,     3,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     1,     1,     4,     1,     2,
+       4,     1,     3,     1,     2,     2,     2,     5,     7,     1,
+       2,     3,     4,     2,     3,     8,     9,     5,     7,     3,
+       2,     1,     1,     1,     1,     1,     1,     2,     2,     3,
+       1,     2,     3
+  };
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
-yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
-  yyresult = 2;
-  /* Fall through.  */
+#if YYDEBUG
+  // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
+  const char*
+  const parser::yytname_[] =
+  {
+  "\"end of file\"", "error", "\"invalid token\"", "IDENTIFIER",
+  "CONSTANT", "STRING_LITERAL", "SIZEOF", "PTR_OP", "INC_OP", "DEC_OP",
+  "LEFT_OP", "RIGHT_OP", "LE_OP", "GE_OP", "EQ_OP", "NE_OP", "AND_OP",
+  "OR_OP", "MUL_ASSIGN", "DIV_ASSIGN", "MOD_ASSIGN", "ADD_ASSIGN",
+  "SUB_ASSIGN", "LEFT_ASSIGN", "RIGHT_ASSIGN", "AND_ASSIGN", "XOR_ASSIGN",
+  "OR_ASSIGN", "TYPE_NAME", "NEG_OP", "ADD_OP", "MUL_OP", "DIV_OP",
+  "MOD_OP", "LT_OP", "GT_OP", "CHAR", "SHORT", "INT", "LONG", "SIGNED",
+  "UNSIGNED", "FLOAT", "DOUBLE", "VOID", "CASE", "DEFAULT", "IF", "ELSE",
+  "SWITCH", "WHILE", "DO", "FOR", "GOTO", "CONTINUE", "BREAK", "RETURN",
+  "'('", "')'", "'['", "']'", "','", "'='", "';'", "'{'", "'}'", "':'",
+  "$accept", "primary_expression", "postfix_expression",
+  "argument_expression_list", "unary_expression", "cast_expression",
+  "multiplicative_expression", "additive_expression", "shift_expression",
+  "relational_expression", "equality_expression", "and_expression",
+  "exclusive_or_expression", "inclusive_or_expression",
+  "logical_and_expression", "logical_or_expression",
+  "conditional_expression", "assignment_expression", "assignment_operator",
+  "expression", "constant_expression", "declaration",
+  "init_declarator_list", "init_declarator", "type_specifier",
+  "declarator", "direct_declarator", "pointer", "func_declarator",
+  "parameter_list", "parameter_declaration", "declaration_statement",
+  "expression_statement", "selection_statement", "switch_clause_list",
+  "switch_clause", "iteration_statement", "jump_statement", "statement",
+  "statement_list", "compound_statement", "translation_unit",
+  "function_definition", YY_NULLPTR
+  };
 #endif
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
-  if (yychar != YYEMPTY)
-    {
-      /* Make sure we have latest lookahead translation.  See comments at
-         user semantic actions for why this is necessary.  */
-      yytoken = YYTRANSLATE (yychar);
-      yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval);
-    }
-  /* Do not reclaim the symbols of the rule whose action triggered
-     this YYABORT or YYACCEPT.  */
-  YYPOPSTACK (yylen);
-  YY_STACK_PRINT (yyss, yyssp);
-  while (yyssp != yyss)
+#if YYDEBUG
+  const short
+  parser::yyrline_[] =
+  {
+       0,    69,    69,    73,    77,    80,    87,    88,    95,   101,
+     112,   119,   129,   132,   139,   140,   147,   175,   180,   184,
+     188,   192,   196,   197,   201,   208,   209,   213,   220,   221,
+     225,   229,   233,   240,   241,   245,   252,   257,   262,   267,
+     268,   275,   276,   283,   288,   292,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   310,   315,   319,
+     326,   330,   337,   344,   353,   354,   355,   356,   357,   358,
+     359,   360,   361,   362,   366,   367,   371,   373,   381,   382,
+     386,   397,   401,   407,   410,   421,   427,   432,   442,   450,
+     454,   461,   465,   469,   473,   480,   488,   497,   504,   515,
+     522,   531,   532,   533,   534,   535,   539,   543,   550,   551,
+     557,   558,   562
+  };
+
+  void
+  parser::yy_stack_print_ () const
+  {
+    *yycdebug_ << "Stack now";
+    for (stack_type::const_iterator
+           i = yystack_.begin (),
+           i_end = yystack_.end ();
+         i != i_end; ++i)
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
+  }
+
+  void
+  parser::yy_reduce_print_ (int yyrule) const
+  {
+    int yylno = yyrline_[yyrule];
+    int yynrhs = yyr2_[yyrule];
+    // Print the symbols being reduced, and their result.
+    *yycdebug_ << "Reducing stack by rule " << yyrule - 1
+               << " (line " << yylno << "):\n";
+    // The symbols being reduced.
+    for (int yyi = 0; yyi < yynrhs; yyi++)
+      YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
+                       yystack_[(yynrhs) - (yyi + 1)]);
+  }
+#endif // YYDEBUG
+
+  parser::symbol_kind_type
+  parser::yytranslate_ (int t) YY_NOEXCEPT
+  {
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const signed char
+    translate_table[] =
     {
-      yydestruct ("Cleanup: popping",
-                  yystos[+*yyssp], yyvsp);
-      YYPOPSTACK (1);
-    }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  return yyresult;
-}
-#line 515 "semic.y"
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      57,    58,     2,     2,    61,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    66,    63,
+       2,    62,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    59,     2,    60,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    64,     2,    65,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56
+    };
+    // Last valid token kind.
+    const int code_max = 311;
+
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
+  }
+
+} // yy
+#line 2854 "semic_grammar.cpp"
 
+#line 569 "semic.y"
+
+
+void yy::parser::error(const location_type& loc, const std::string& msg)
+{
+    throw std::runtime_error(std::to_string(loc.begin.line) + ":" + std::to_string(loc.begin.column) + ": " + msg);
+}
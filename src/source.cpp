@@ -0,0 +1,88 @@
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "source.hpp"
+
+static std::runtime_error source_error(const std::string &path, const char* what) {
+    return std::runtime_error((path.empty() ? std::string("<stdin>") : path) + ": " + what + ": " + strerror(errno));
+}
+
+SourceFile SourceFile::open(const std::string &path) {
+    int fd = path.empty() ? STDIN_FILENO : ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw source_error(path, "cannot open");
+    }
+
+    SourceFile source;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        // reserve zeroed pages past the end of the file for the NUL bytes,
+        // then map the file over the front of them
+        source.length = static_cast<size_t>(info.st_size);
+        auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        source.mapped_size = (source.length + 2 + page - 1) / page * page;
+        void* region = mmap(nullptr, source.mapped_size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region != MAP_FAILED) {
+            source.mapped = static_cast<char*>(region);
+            if (mmap(region, source.length, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED) {
+                if (fd != STDIN_FILENO) {
+                    close(fd);
+                }
+                return source;
+            }
+            munmap(region, source.mapped_size);
+            source.mapped = nullptr;
+        }
+    }
+
+    // pipes and terminals are read in full
+    char chunk[1 << 16];
+    source.buffer.clear();
+    for (;;) {
+        ssize_t count = read(fd, chunk, sizeof(chunk));
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count < 0) {
+            throw source_error(path, "cannot read");
+        }
+        if (count == 0) {
+            break;
+        }
+        source.buffer.insert(source.buffer.end(), chunk, chunk + count);
+    }
+    if (fd != STDIN_FILENO) {
+        close(fd);
+    }
+    source.length = source.buffer.size();
+    source.buffer.resize(source.length + 2, '\0');
+    return source;
+}
+
+SourceFile SourceFile::from_string(std::string_view text) {
+    SourceFile source;
+    source.buffer.assign(text.begin(), text.end());
+    source.length = source.buffer.size();
+    source.buffer.resize(source.length + 2, '\0');
+    return source;
+}
+
+SourceFile::SourceFile(SourceFile &&other) :
+    mapped(other.mapped), mapped_size(other.mapped_size),
+    buffer(std::move(other.buffer)), length(other.length) {
+    other.mapped = nullptr;
+}
+
+SourceFile::~SourceFile() {
+    if (mapped) {
+        munmap(mapped, mapped_size);
+    }
+}
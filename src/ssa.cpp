@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <unordered_map>
+
+#include "cfg.hpp"
+#include "pass.hpp"
+
+// narrow integers have no arithmetic of their own, so `c++` on a char
+// cannot be rewritten into an addition; they stay in their slots
+static bool is_promotable(Type* type) {
+    return select_binary_kernel(IROptype::add, ir_kind_of(type)) != nullptr;
+}
+
+static IRValue small_constant(IRFunction &func, Type* type, int n) {
+    switch (ir_kind_of(type)) {
+    case IRKind::f32: return func.add_constant(type, Value::from_float(static_cast<float>(n)));
+    case IRKind::f64: return func.add_constant(type, Value::from_double(n));
+    default: return func.add_constant(type, Value::from_int(static_cast<uint64_t>(n)));
+    }
+}
+
+void construct_ssa(IRFunction &func) {
+    ControlFlowGraph cfg(func);
+    // a loop back to the entry would need a phi for the incoming values
+    if (!cfg.preds[0].empty()) {
+        return;
+    }
+
+    // variables by slot; a parameter starts out as itself, a local as 0
+    size_t slot_count = static_cast<size_t>(func.slot_count);
+    std::vector<int> var_of_slot(slot_count, -1);
+    std::vector<bool> rejected(slot_count);
+    std::vector<Type*> var_types;
+    std::vector<IRValue> initial_values;
+    auto add_variable = [&](const IRValue &var, bool is_arg) {
+        size_t slot = static_cast<size_t>(var.get_slot());
+        Type* type = func.type_tables[var.get_symbol()];
+        if (type != var.value_type || !is_promotable(type)) {
+            rejected[slot] = true;
+        } else if (var_of_slot[slot] < 0) {
+            var_of_slot[slot] = static_cast<int>(var_types.size());
+            var_types.push_back(type);
+            initial_values.push_back(is_arg ? var : small_constant(func, type, 0));
+        }
+    };
+    for (auto &arg : func.arg_vec) {
+        add_variable(arg, true);
+    }
+    for (auto &decl : func.decl_vec) {
+        add_variable(decl, false);
+    }
+    for (size_t slot = 0; slot < slot_count; slot++) {
+        if (rejected[slot]) {
+            var_of_slot[slot] = -1;
+        }
+    }
+    size_t var_count = var_types.size();
+    if (var_count == 0) {
+        return;
+    }
+
+    // the promoted variable an assign, inc or dec writes, -1 for others
+    auto written_var = [&](IR* ir) {
+        const IRValue* target = nullptr;
+        if (ir->type == IROptype::assign) {
+            target = &static_cast<IRBinary*>(ir)->lhs;
+        } else if (ir->type == IROptype::inc || ir->type == IROptype::dec) {
+            target = &static_cast<IRUnary*>(ir)->lhs;
+        }
+        if (!target || target->type != IROpearndType::id || target->get_slot() < 0) {
+            return -1;
+        }
+        return var_of_slot[static_cast<size_t>(target->get_slot())];
+    };
+
+    // phis on the iterated dominance frontier of the blocks writing each
+    // variable
+    size_t block_count = func.body.size();
+    std::vector<std::vector<int>> def_blocks(var_count);
+    for (int bid : cfg.order) {
+        for (auto ir : func.body[static_cast<size_t>(bid)]->statements) {
+            int var = written_var(ir);
+            if (var < 0) {
+                continue;
+            }
+            auto &blocks = def_blocks[static_cast<size_t>(var)];
+            if (blocks.empty() || blocks.back() != bid) {
+                blocks.push_back(bid);
+            }
+        }
+    }
+    auto frontiers = cfg.dominance_frontiers();
+    std::vector<std::vector<std::pair<int, IRPhi*>>> phis(block_count);
+    std::vector<int> has_phi(block_count, -1), queued(block_count, -1);
+    for (size_t index = 0; index < var_count; index++) {
+        int var = static_cast<int>(index);
+        std::vector<int> worklist = def_blocks[index];
+        for (int bid : worklist) {
+            queued[static_cast<size_t>(bid)] = var;
+        }
+        while (!worklist.empty()) {
+            int bid = worklist.back();
+            worklist.pop_back();
+            for (int join : frontiers[static_cast<size_t>(bid)]) {
+                size_t at = static_cast<size_t>(join);
+                if (has_phi[at] == var) {
+                    continue;
+                }
+                has_phi[at] = var;
+                auto phi = func.arena.make<IRPhi>(var_types[index]);
+                phi->result_slot = func.add_slot();
+                phis[at].push_back({ var, phi });
+                if (queued[at] != var) {
+                    queued[at] = var;
+                    worklist.push_back(join);
+                }
+            }
+        }
+    }
+
+    // rename along the dominator tree; each variable keeps a stack of its
+    // definitions, and the value of a removed assignment expression is
+    // forwarded to whoever reads its temp
+    std::vector<std::vector<IRValue>> stacks(var_count);
+    for (size_t var = 0; var < var_count; var++) {
+        stacks[var].push_back(initial_values[var]);
+    }
+    std::unordered_map<int, IRValue> forwarded;
+    auto rename = [&](IRValue &value) {
+        if (value.type == IROpearndType::id && value.get_slot() >= 0) {
+            int var = var_of_slot[static_cast<size_t>(value.get_slot())];
+            if (var >= 0) {
+                value = stacks[static_cast<size_t>(var)].back();
+            }
+        } else if (value.type == IROpearndType::temp) {
+            auto it = forwarded.find(value.get_slot());
+            if (it != forwarded.end()) {
+                value = it->second;
+            }
+        }
+    };
+
+    std::vector<std::vector<int>> pushed(block_count);
+    std::vector<std::pair<int, bool>> walk { { 0, false } };
+    while (!walk.empty()) {
+        size_t bid = static_cast<size_t>(walk.back().first);
+        bool leaving = walk.back().second;
+        walk.pop_back();
+        if (leaving) {
+            for (int var : pushed[bid]) {
+                stacks[static_cast<size_t>(var)].pop_back();
+            }
+            continue;
+        }
+        walk.push_back({ static_cast<int>(bid), true });
+
+        auto block = func.body[bid];
+        auto define = [&](int var, IRValue value) {
+            stacks[static_cast<size_t>(var)].push_back(value);
+            pushed[bid].push_back(var);
+        };
+        std::vector<IR*> statements;
+        for (auto &[var, phi] : phis[bid]) {
+            define(var, IRValue::from_temp(phi->value_type, phi->result_slot));
+            statements.push_back(phi);
+        }
+        for (auto ir : block->statements) {
+            int var = written_var(ir);
+            if (var < 0) {
+                ir->visit_operands(rename);
+                statements.push_back(ir);
+                continue;
+            }
+            Type* type = var_types[static_cast<size_t>(var)];
+            if (ir->type == IROptype::assign) {
+                IRValue value = static_cast<IRBinary*>(ir)->rhs;
+                rename(value);
+                if (ir->result_slot >= 0) {
+                    forwarded.emplace(ir->result_slot, value);
+                }
+                define(var, value);
+            } else {
+                // inc and dec yield the updated value, as the addition does
+                auto step = func.arena.make<IRBinary>(
+                    ir->type == IROptype::inc ? IROptype::add : IROptype::minus,
+                    stacks[static_cast<size_t>(var)].back(),
+                    small_constant(func, type, 1)
+                );
+                step->result_slot = ir->result_slot >= 0 ? ir->result_slot : func.add_slot();
+                statements.push_back(step);
+                define(var, IRValue::from_temp(type, step->result_slot));
+            }
+        }
+        block->statements = std::move(statements);
+        if (auto value = block->jump.operand()) {
+            rename(*value);
+        }
+
+        for (int succ : cfg.succs[bid]) {
+            for (auto &[var, phi] : phis[static_cast<size_t>(succ)]) {
+                phi->incoming.push_back({ static_cast<int>(bid), stacks[static_cast<size_t>(var)].back() });
+            }
+        }
+        for (int child : cfg.dom_children[bid]) {
+            walk.push_back({ child, false });
+        }
+    }
+
+    // drop the phis nothing reads, which also frees what they read
+    // the renaming added slots
+    slot_count = static_cast<size_t>(func.slot_count);
+    std::vector<int> uses(slot_count);
+    std::vector<IRPhi*> phi_of_slot(slot_count);
+    for (int bid : cfg.order) {
+        auto block = func.body[static_cast<size_t>(bid)];
+        for (auto ir : block->statements) {
+            bool is_phi = ir->type == IROptype::phi;
+            if (is_phi) {
+                phi_of_slot[static_cast<size_t>(ir->result_slot)] = static_cast<IRPhi*>(ir);
+            }
+            ir->visit_operands([&](IRValue &value) {
+                // a phi reading itself keeps nothing alive
+                if (value.type == IROpearndType::temp && !(is_phi && value.get_slot() == ir->result_slot)) {
+                    uses[static_cast<size_t>(value.get_slot())]++;
+                }
+            });
+        }
+        if (auto value = block->jump.operand()) {
+            if (value->type == IROpearndType::temp) {
+                uses[static_cast<size_t>(value->get_slot())]++;
+            }
+        }
+    }
+    std::vector<IRPhi*> dead;
+    for (auto phi : phi_of_slot) {
+        if (phi && uses[static_cast<size_t>(phi->result_slot)] == 0) {
+            dead.push_back(phi);
+        }
+    }
+    std::vector<bool> removed(slot_count);
+    while (!dead.empty()) {
+        auto phi = dead.back();
+        dead.pop_back();
+        removed[static_cast<size_t>(phi->result_slot)] = true;
+        for (auto &edge : phi->incoming) {
+            auto &value = edge.second;
+            if (value.type != IROpearndType::temp || value.get_slot() == phi->result_slot) {
+                continue;
+            }
+            size_t slot = static_cast<size_t>(value.get_slot());
+            auto source = phi_of_slot[slot];
+            if (--uses[slot] == 0 && source && !removed[slot]) {
+                dead.push_back(source);
+            }
+        }
+    }
+    for (int bid : cfg.order) {
+        auto &statements = func.body[static_cast<size_t>(bid)]->statements;
+        statements.erase(std::remove_if(statements.begin(), statements.end(), [&](IR* ir) {
+            return ir->type == IROptype::phi && removed[static_cast<size_t>(ir->result_slot)];
+        }), statements.end());
+    }
+}
+
+namespace {
+
+struct PendingCopy {
+    int slot;
+    Type* type;
+    IRValue value;
+};
+
+}
+
+// Appends the parallel copy `copies` to `block` as a sequence of assigns.
+// A copy waits while another one still reads its destination; when all of
+// them wait they form cycles, broken by saving one destination first.
+static void append_copies(IRFunction &func, IRBlock* block, std::vector<PendingCopy> copies) {
+    auto emit = [&](int slot, Type* type, IRValue value) {
+        block->statements.push_back(
+            func.arena.make<IRBinary>(IROptype::assign, IRValue::from_temp(type, slot), value)
+        );
+    };
+    auto reads = [&](int slot) {
+        return std::any_of(copies.begin(), copies.end(), [&](const PendingCopy &copy) {
+            return copy.value.type == IROpearndType::temp && copy.value.get_slot() == slot;
+        });
+    };
+    copies.erase(std::remove_if(copies.begin(), copies.end(), [](const PendingCopy &copy) {
+        return copy.value.type == IROpearndType::temp && copy.value.get_slot() == copy.slot;
+    }), copies.end());
+
+    while (!copies.empty()) {
+        auto ready = std::find_if(copies.begin(), copies.end(), [&](const PendingCopy &copy) {
+            return !reads(copy.slot);
+        });
+        if (ready != copies.end()) {
+            emit(ready->slot, ready->type, ready->value);
+            copies.erase(ready);
+            continue;
+        }
+        int blocked = copies.front().slot;
+        int saved = func.add_slot();
+        emit(saved, copies.front().type, IRValue::from_temp(copies.front().type, blocked));
+        for (auto &copy : copies) {
+            if (copy.value.type == IROpearndType::temp && copy.value.get_slot() == blocked) {
+                copy.value = IRValue::from_temp(copy.value.value_type, saved);
+            }
+        }
+    }
+}
+
+void destruct_ssa(IRFunction &func) {
+    size_t block_count = func.body.size();
+    for (size_t bid = 0; bid < block_count; bid++) {
+        auto block = func.body[bid];
+        auto &statements = block->statements;
+        auto first_other = std::find_if(statements.begin(), statements.end(), [](IR* ir) {
+            return ir->type != IROptype::phi;
+        });
+        std::vector<IRPhi*> phis;
+        for (auto it = statements.begin(); it != first_other; it++) {
+            phis.push_back(static_cast<IRPhi*>(*it));
+        }
+        statements.erase(statements.begin(), first_other);
+        if (phis.empty()) {
+            continue;
+        }
+
+        std::vector<int> preds;
+        for (auto &edge : phis.front()->incoming) {
+            preds.push_back(edge.first);
+        }
+        for (int pred : preds) {
+            std::vector<PendingCopy> copies;
+            for (auto phi : phis) {
+                auto edge = std::find_if(phi->incoming.begin(), phi->incoming.end(), [&](const std::pair<int, IRValue> &incoming) {
+                    return incoming.first == pred;
+                });
+                if (edge == phi->incoming.end()) {
+                    throw std::runtime_error("Phi without a value from b" + std::to_string(pred));
+                }
+                copies.push_back({ phi->result_slot, phi->value_type, edge->second });
+            }
+
+            // copies on an edge leaving a branch get a block of their own,
+            // or they would run on the other edge too
+            IRBlock* at = func.body[static_cast<size_t>(pred)];
+            auto targets = at->jump.targets();
+            bool shared = std::any_of(targets.begin(), targets.end(), [&](int target) {
+                return target != static_cast<int>(bid);
+            });
+            if (shared) {
+                auto split = func.arena.make<IRBlock>(static_cast<int>(func.body.size()));
+                func.body.push_back(split);
+                split->jump = IRJump::from_direct_jump(static_cast<int>(bid));
+                at->jump.replace_target(static_cast<int>(bid), split->bid);
+                at = split;
+            }
+            append_copies(func, at, copies);
+        }
+    }
+}
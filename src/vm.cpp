@@ -0,0 +1,395 @@
+#include <algorithm>
+#include <iostream>
+
+#include "vm.hpp"
+
+// Direct threading needs the labels-as-values extension; other compilers
+// fall back to a switch over the opcode. -Wpedantic is silenced only
+// around the label table and the computed gotos.
+#if defined(__GNUC__)
+#define PAKAO_COMPUTED_GOTO 1
+#else
+#define PAKAO_COMPUTED_GOTO 0
+#endif
+
+VirtualMachine::VirtualMachine(BytecodeModule &n_module, size_t n_memory_size) :
+    module(n_module), stack(1 << 16), memory(n_memory_size) {
+    execute(true);
+}
+
+void VirtualMachine::run() {
+    if (module.entry < 0) {
+        throw std::runtime_error("No main function");
+    }
+    frames.clear();
+    execute(false);
+}
+
+BCSlot* VirtualMachine::push_frame(const BCFunction &func, const BCInstruction* return_pc, int32_t result_slot) {
+    size_t base = frames.empty() ? 0 : frames.back().base + static_cast<size_t>(frames.back().func->frame_size);
+    size_t top = base + static_cast<size_t>(func.frame_size);
+    if (top > stack.size()) {
+        stack.resize(std::max(top, stack.size() * 2));
+    }
+
+    BCSlot* fp = stack.data() + base;
+    memset(fp, 0, sizeof(BCSlot) * static_cast<size_t>(func.constant_base));
+    if (!func.constants.empty()) {
+        memcpy(fp + func.constant_base, func.constants.data(), sizeof(BCSlot) * func.constants.size());
+    }
+
+    frames.push_back(Frame { &func, return_pc, base, memory.mark(), result_slot });
+    for (auto &array : func.arrays) {
+        fp[array.slot].p = memory.allocate(array.size);
+    }
+    return fp;
+}
+
+void VirtualMachine::print_value(BCSlot value, BCKind kind) {
+    switch (kind) {
+    case BCKind::integer:
+        std::cout << value.l;
+        break;
+    case BCKind::float32:
+        std::cout << value.f;
+        break;
+    case BCKind::float64:
+        std::cout << value.d;
+        break;
+    case BCKind::pointer:
+        std::cout << value.p;
+        break;
+    case BCKind::string:
+        std::cout << *value.s;
+        break;
+    default:
+        break;
+    }
+}
+
+void VirtualMachine::print_arguments(const std::vector<BCPrintArgument> &args, const BCSlot* fp) {
+    for (size_t i = 0; i < args.size(); i++) {
+        auto &arg = args[i];
+        BCSlot value = fp[arg.slot];
+        if (arg.array_length > 0) {
+            std::cout << '[';
+            for (size_t j = 0; j < arg.array_length; j++) {
+                char* element = static_cast<char*>(value.p) + j * arg.element_size;
+                BCSlot element_value;
+                element_value.i = 0;
+                if (arg.element_kind == BCKind::integer) {
+                    switch (arg.element_size) {
+                    case 1: element_value.l = *reinterpret_cast<int8_t*>(element); break;
+                    case 2: element_value.l = *reinterpret_cast<int16_t*>(element); break;
+                    case 4: element_value.l = *reinterpret_cast<int32_t*>(element); break;
+                    default: element_value.l = *reinterpret_cast<int64_t*>(element); break;
+                    }
+                } else {
+                    memcpy(&element_value, element, arg.element_size);
+                }
+                print_value(element_value, arg.element_kind);
+                if (j < arg.array_length - 1) {
+                    std::cout << ", ";
+                }
+            }
+            std::cout << ']';
+        } else {
+            print_value(value, arg.kind);
+        }
+        if (i < args.size() - 1) {
+            std::cout << ", ";
+        }
+    }
+}
+
+#if PAKAO_COMPUTED_GOTO
+#define VM_CASE(name) L_##name:
+#define VM_DISPATCH() \
+    _Pragma("GCC diagnostic push") \
+    _Pragma("GCC diagnostic ignored \"-Wpedantic\"") \
+    goto *pc->handler; \
+    _Pragma("GCC diagnostic pop")
+#else
+#define VM_CASE(name) case BCOpcode::name:
+#define VM_DISPATCH() goto dispatch
+#endif
+
+#define VM_NEXT() pc++; VM_DISPATCH()
+
+#define VM_ARITH(name, field, op) \
+    VM_CASE(name) { fp[pc->a].field = fp[pc->b].field op fp[pc->c].field; VM_NEXT(); }
+
+#define VM_ARITH_W(name, op) \
+    VM_CASE(name) { \
+        fp[pc->a].l = static_cast<int32_t>(static_cast<uint32_t>(fp[pc->b].i op fp[pc->c].i)); \
+        VM_NEXT(); \
+    }
+
+#define VM_STEP_W(name, op) \
+    VM_CASE(name) { \
+        fp[pc->b].l = static_cast<int32_t>(static_cast<uint32_t>(fp[pc->b].i op 1)); \
+        fp[pc->a] = fp[pc->b]; \
+        VM_NEXT(); \
+    }
+
+#define VM_SEXT(name, type) \
+    VM_CASE(name) { fp[pc->a].l = static_cast<type>(fp[pc->b].i); VM_NEXT(); }
+
+#define VM_COMPARE(name, field, op) \
+    VM_CASE(name) { fp[pc->a].i = fp[pc->b].field op fp[pc->c].field; VM_NEXT(); }
+
+#define VM_STEP(name, field, op) \
+    VM_CASE(name) { fp[pc->b].field op; fp[pc->a] = fp[pc->b]; VM_NEXT(); }
+
+#define VM_CONVERT(name, from, to, type) \
+    VM_CASE(name) { fp[pc->a].to = static_cast<type>(fp[pc->b].from); VM_NEXT(); }
+
+#define VM_INDEX(name, scale) \
+    VM_CASE(name) { \
+        fp[pc->a].p = static_cast<char*>(fp[pc->b].p) + fp[pc->c].l * scale; \
+        VM_NEXT(); \
+    }
+
+#define VM_LOAD_INT(name, type) \
+    VM_CASE(name) { \
+        fp[pc->a].l = *static_cast<type*>(fp[pc->b].p); \
+        VM_NEXT(); \
+    }
+
+#define VM_STORE_INT(name, type) \
+    VM_CASE(name) { \
+        *static_cast<type*>(fp[pc->a].p) = static_cast<type>(fp[pc->b].i); \
+        VM_NEXT(); \
+    }
+
+void VirtualMachine::execute(bool thread_only) {
+#if PAKAO_COMPUTED_GOTO
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+    static const void* labels[] = {
+#define BYTECODE_LABEL(name) &&L_##name,
+        BYTECODE_OPCODES(BYTECODE_LABEL)
+#undef BYTECODE_LABEL
+    };
+#pragma GCC diagnostic pop
+#endif
+    if (thread_only) {
+#if PAKAO_COMPUTED_GOTO
+        for (auto &func : module.functions) {
+            for (auto &ins : func.code) {
+                ins.handler = labels[static_cast<size_t>(ins.op)];
+            }
+        }
+#endif
+        return;
+    }
+
+    const BCFunction* func = &module.functions[static_cast<size_t>(module.entry)];
+    BCSlot* fp = push_frame(*func, nullptr, -1);
+    const BCInstruction* pc = func->code.data();
+
+#if PAKAO_COMPUTED_GOTO
+    VM_DISPATCH();
+#else
+dispatch:
+    switch (pc->op) {
+#endif
+
+    VM_CASE(mov) { fp[pc->a] = fp[pc->b]; VM_NEXT(); }
+
+    VM_ARITH_W(add_w, +)
+    VM_ARITH_W(sub_w, -)
+    VM_ARITH_W(mul_w, *)
+    VM_CASE(div_w) { fp[pc->a].l = static_cast<int32_t>(fp[pc->b].l / fp[pc->c].l); VM_NEXT(); }
+    VM_ARITH(add_i, i, +)
+    VM_ARITH(sub_i, i, -)
+    VM_ARITH(mul_i, i, *)
+    VM_ARITH(div_i, l, /)
+    VM_ARITH(add_f, f, +)
+    VM_ARITH(sub_f, f, -)
+    VM_ARITH(mul_f, f, *)
+    VM_ARITH(div_f, f, /)
+    VM_ARITH(add_d, d, +)
+    VM_ARITH(sub_d, d, -)
+    VM_ARITH(mul_d, d, *)
+    VM_ARITH(div_d, d, /)
+
+    VM_COMPARE(lt_i, l, <)
+    VM_COMPARE(gt_i, l, >)
+    VM_COMPARE(le_i, l, <=)
+    VM_COMPARE(ge_i, l, >=)
+    VM_COMPARE(lt_f, f, <)
+    VM_COMPARE(gt_f, f, >)
+    VM_COMPARE(le_f, f, <=)
+    VM_COMPARE(ge_f, f, >=)
+    VM_COMPARE(lt_d, d, <)
+    VM_COMPARE(gt_d, d, >)
+    VM_COMPARE(le_d, d, <=)
+    VM_COMPARE(ge_d, d, >=)
+    VM_COMPARE(and_i, i, &&)
+    VM_COMPARE(or_i, i, ||)
+    VM_COMPARE(and_f, f, &&)
+    VM_COMPARE(or_f, f, ||)
+    VM_COMPARE(and_d, d, &&)
+    VM_COMPARE(or_d, d, ||)
+
+    VM_STEP_W(inc_w, +)
+    VM_STEP_W(dec_w, -)
+    VM_STEP(inc_i, i, += 1)
+    VM_STEP(dec_i, i, -= 1)
+    VM_STEP(inc_f, f, += 1.0f)
+    VM_STEP(dec_f, f, -= 1.0f)
+    VM_STEP(inc_d, d, += 1.0)
+    VM_STEP(dec_d, d, -= 1.0)
+
+    VM_CONVERT(cvt_i_f, l, f, float)
+    VM_CONVERT(cvt_i_d, l, d, double)
+    VM_CONVERT(cvt_f_i, f, l, int64_t)
+    VM_CONVERT(cvt_d_i, d, l, int64_t)
+    VM_CONVERT(cvt_f_d, f, d, double)
+    VM_CONVERT(cvt_d_f, d, f, float)
+
+    VM_SEXT(sext_8, int8_t)
+    VM_SEXT(sext_16, int16_t)
+    VM_SEXT(sext_32, int32_t)
+
+    VM_INDEX(index_1, 1)
+    VM_INDEX(index_2, 2)
+    VM_INDEX(index_4, 4)
+    VM_INDEX(index_8, 8)
+
+    VM_LOAD_INT(load_i8, int8_t)
+    VM_LOAD_INT(load_i16, int16_t)
+    VM_LOAD_INT(load_i32, int32_t)
+    VM_LOAD_INT(load_i64, int64_t)
+    VM_CASE(load_f) { fp[pc->a].f = *static_cast<float*>(fp[pc->b].p); VM_NEXT(); }
+    VM_CASE(load_d) { fp[pc->a].d = *static_cast<double*>(fp[pc->b].p); VM_NEXT(); }
+
+    VM_STORE_INT(store_i8, int8_t)
+    VM_STORE_INT(store_i16, int16_t)
+    VM_STORE_INT(store_i32, int32_t)
+    VM_STORE_INT(store_i64, int64_t)
+    VM_CASE(store_f) { *static_cast<float*>(fp[pc->a].p) = fp[pc->b].f; VM_NEXT(); }
+    VM_CASE(store_d) { *static_cast<double*>(fp[pc->a].p) = fp[pc->b].d; VM_NEXT(); }
+
+    VM_CASE(jmp) {
+        pc = func->code.data() + pc->a;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(br_true) {
+        pc = fp[pc->b].i ? func->code.data() + pc->a : pc + 1;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(br_false) {
+        pc = fp[pc->b].i ? pc + 1 : func->code.data() + pc->a;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(br_true_f) {
+        pc = fp[pc->b].f != 0.0f ? func->code.data() + pc->a : pc + 1;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(br_false_f) {
+        pc = fp[pc->b].f != 0.0f ? pc + 1 : func->code.data() + pc->a;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(br_true_d) {
+        pc = fp[pc->b].d != 0.0 ? func->code.data() + pc->a : pc + 1;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(br_false_d) {
+        pc = fp[pc->b].d != 0.0 ? pc + 1 : func->code.data() + pc->a;
+        VM_DISPATCH();
+    }
+
+    VM_CASE(switch_table) {
+        const BCSwitchTable &table = func->switch_tables[static_cast<size_t>(pc->a)];
+        uint64_t index = fp[pc->b].i - static_cast<uint64_t>(table.low);
+        pc = func->code.data() + (index < table.targets.size() ? table.targets[index] : table.default_target);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(switch_search) {
+        const BCSwitchTable &table = func->switch_tables[static_cast<size_t>(pc->a)];
+        int64_t key = fp[pc->b].l;
+        auto it = std::lower_bound(table.keys.begin(), table.keys.end(), key);
+        bool found = it != table.keys.end() && *it == key;
+        pc = func->code.data() + (found ? table.targets[static_cast<size_t>(it - table.keys.begin())] : table.default_target);
+        VM_DISPATCH();
+    }
+
+    VM_CASE(call) {
+        const BCCallSite &site = func->call_sites[static_cast<size_t>(pc->a)];
+        const BCFunction &callee = module.functions[static_cast<size_t>(site.callee)];
+
+        std::cout << callee.name << '(';
+        print_arguments(site.print_args, fp);
+        std::cout << ')' << '\n';
+
+        size_t caller_base = frames.back().base;
+        BCSlot* callee_fp = push_frame(callee, pc + 1, site.result_slot);
+        fp = stack.data() + caller_base;
+        size_t count = std::min(site.arg_slots.size(), static_cast<size_t>(callee.param_count));
+        for (size_t i = 0; i < count; i++) {
+            callee_fp[i] = fp[site.arg_slots[i]];
+        }
+
+        func = &callee;
+        fp = callee_fp;
+        pc = callee.code.data();
+        VM_DISPATCH();
+    }
+
+    VM_CASE(printf) {
+        const BCPrintSite &site = func->print_sites[static_cast<size_t>(pc->a)];
+        if (!site.print_args.empty()) {
+            std::cout << "printf(";
+            print_arguments(site.print_args, fp);
+            std::cout << ')' << '\n';
+        }
+        VM_NEXT();
+    }
+
+    VM_CASE(ret) {
+        BCSlot value = fp[pc->a];
+        std::cout << "return(";
+        print_value(value, func->return_kind);
+        std::cout << ")" << '\n';
+
+        Frame frame = frames.back();
+        frames.pop_back();
+        memory.release(frame.memory_mark);
+        if (frames.empty()) {
+            return;
+        }
+        func = frames.back().func;
+        fp = stack.data() + frames.back().base;
+        pc = frame.return_pc;
+        if (frame.result_slot >= 0) {
+            fp[frame.result_slot] = value;
+        }
+        VM_DISPATCH();
+    }
+
+    VM_CASE(ret_void) {
+        Frame frame = frames.back();
+        frames.pop_back();
+        memory.release(frame.memory_mark);
+        if (frames.empty()) {
+            return;
+        }
+        func = frames.back().func;
+        fp = stack.data() + frames.back().base;
+        pc = frame.return_pc;
+        VM_DISPATCH();
+    }
+
+#if !PAKAO_COMPUTED_GOTO
+    }
+#endif
+}
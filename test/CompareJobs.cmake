@@ -0,0 +1,33 @@
+# Compiles a program on one thread and then several times on JOBS threads
+# and checks that the IR dump and everything the program prints are the
+# same every time, whichever thread generated which function.
+#
+# PAKAO_LANG is the executable, PROGRAM the source, JOBS the number of
+# threads, RUNS how often the threaded compile is repeated and OUTPUT
+# the prefix of the files the outputs are kept in.
+
+execute_process(
+  COMMAND ${PAKAO_LANG} --jobs 1 ${PROGRAM}
+  OUTPUT_FILE ${OUTPUT}.1.txt
+  RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${PROGRAM} exited with ${result} on one thread")
+endif()
+file(READ ${OUTPUT}.1.txt expected)
+
+foreach(run RANGE 1 ${RUNS})
+  execute_process(
+    COMMAND ${PAKAO_LANG} --jobs ${JOBS} ${PROGRAM}
+    OUTPUT_FILE ${OUTPUT}.${JOBS}.txt
+    RESULT_VARIABLE result
+  )
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${PROGRAM} exited with ${result} on ${JOBS} threads")
+  endif()
+  file(READ ${OUTPUT}.${JOBS}.txt actual)
+  if(NOT actual STREQUAL expected)
+    message(FATAL_ERROR "${PROGRAM} compiled on ${JOBS} threads differs from "
+      "the single-threaded compile on run ${run}, see ${OUTPUT}.${JOBS}.txt")
+  endif()
+endforeach()
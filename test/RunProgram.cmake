@@ -0,0 +1,23 @@
+# Runs a sample program and compares everything it prints, the call
+# trace included, with the expected output. The IR dump depends on the
+# mode and is left out with --no-dump.
+#
+# PAKAO_LANG is the executable, FLAGS the options of the mode separated
+# by spaces, PROGRAM the source, EXPECTED the file of the expected output
+# and OUTPUT where the actual output is kept.
+
+separate_arguments(FLAGS)
+execute_process(
+  COMMAND ${PAKAO_LANG} --no-dump ${FLAGS} ${PROGRAM}
+  OUTPUT_FILE ${OUTPUT}
+  RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${PROGRAM} exited with ${result}")
+endif()
+
+file(READ ${OUTPUT} actual)
+file(READ ${EXPECTED} expected)
+if(NOT actual STREQUAL expected)
+  message(FATAL_ERROR "${PROGRAM} printed\n${actual}\ninstead of\n${expected}")
+endif()
@@ -0,0 +1,28 @@
+int test(float f, double d) {
+    int taken;
+    taken = 0;
+    if (f) {
+        taken = taken + 1;
+    }
+    if (d) {
+        taken = taken + 10;
+    }
+    while (f) {
+        taken = taken + 100;
+        f = 0;
+    }
+    return taken;
+}
+int main(void) {
+    float half;
+    double quarter;
+    half = 1;
+    half = half / 2;
+    quarter = 1;
+    quarter = quarter / 4;
+    printf("%d %d %d\n", test(half, quarter), test(0, 0), test(0, quarter));
+    if (half) {
+        printf("%f\n", half);
+    }
+    return 0;
+}
@@ -0,0 +1,30 @@
+float scale(float f, float g) {
+    return (1 + f) * g;
+}
+int main(void) {
+    float third;
+    float tiny;
+    float sum;
+    double exact;
+    int i;
+    int rounded;
+    third = 1;
+    third = third / 3;
+    tiny = 1;
+    tiny = tiny / 16777216;
+    i = 0;
+    while (i < 4) {
+        sum = (1 + tiny) * third;
+        rounded = sum > third;
+        printf("%d ", rounded);
+        tiny = tiny * 2;
+        i++;
+    }
+    printf("\n");
+    sum = 16777216;
+    sum = sum + 1;
+    exact = 16777216;
+    exact = exact + 1;
+    printf("%d %d\n", sum < exact, scale(tiny, third) > third);
+    return 0;
+}
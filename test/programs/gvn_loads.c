@@ -0,0 +1,21 @@
+int bump(int *p) {
+    p[0] = p[0] + 1;
+    return 0;
+}
+int main(void) {
+    int a[2];
+    int x;
+    int y;
+    int z;
+    int w;
+    a[0] = 1;
+    a[1] = 2;
+    x = a[0] + a[1];
+    y = a[0] + a[1];
+    a[0] = 5;
+    z = a[0] + a[1];
+    bump(a);
+    w = a[0] + a[1];
+    printf("%d %d %d %d\n", x, y, z, w);
+    return 0;
+}
@@ -0,0 +1,42 @@
+int square(int v) {
+    return v * v;
+}
+int add_squares(int a, int b) {
+    int r;
+    r = square(a) + square(b);
+    return r;
+}
+int fact(int n) {
+    if (n < 2) {
+        return 1;
+    }
+    return n * fact(n - 1);
+}
+int is_even(int n) {
+    if (n < 1) {
+        return 1;
+    }
+    return is_odd(n - 1);
+}
+int is_odd(int n) {
+    if (n < 1) {
+        return 0;
+    }
+    return is_even(n - 1);
+}
+int counter(int step) {
+    int local;
+    local = local + step;
+    return local;
+}
+int main(void) {
+    int i;
+    int s;
+    s = 0;
+    for (i = 0; i < 4; i++) {
+        s = s + add_squares(i, 1) + counter(i);
+    }
+    printf("%d %d\n", s, fact(5));
+    printf("%d %d\n", is_even(6), is_odd(6));
+    return 0;
+}
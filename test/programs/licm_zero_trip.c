@@ -0,0 +1,28 @@
+int scale(int n, int m, int d) {
+    int i;
+    int s;
+    s = 0;
+    for (i = 0; i < n; i++) {
+        s = s + m * 3 + 100 / d;
+    }
+    return s;
+}
+int main(void) {
+    int a[3];
+    int i;
+    int s;
+    a[0] = 4;
+    printf("%d %d\n", scale(3, 2, 10), scale(0, 2, 0));
+    s = 0;
+    i = 0;
+    while (i < 0) {
+        s = s + a[0] * 2;
+        i++;
+    }
+    do {
+        s = s + a[0] * 2;
+        i++;
+    } while (i < 3);
+    printf("%d %d\n", s, i);
+    return 0;
+}
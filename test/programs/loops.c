@@ -0,0 +1,37 @@
+int count_down(int n) {
+    int steps;
+    steps = 0;
+    while (n > 0) {
+        n = n - 1;
+        steps++;
+    }
+    return steps;
+}
+int main(void) {
+    int i;
+    int s;
+    int runs;
+    printf("%d %d\n", count_down(4), count_down(0));
+    s = 0;
+    i = 10;
+    while (i < 5) {
+        s = s + 1;
+    }
+    runs = 0;
+    do {
+        runs++;
+    } while (i < 5);
+    printf("%d %d %d\n", s, runs, i);
+    s = 0;
+    for (i = 0; i < 0; i++) {
+        s = s + 100;
+    }
+    for (i = 0; i < 100; i++) {
+        if (i > 6) {
+            break;
+        }
+        s = s + i;
+    }
+    printf("%d %d\n", s, i);
+    return 0;
+}
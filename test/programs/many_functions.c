@@ -0,0 +1,680 @@
+int f0(int *p, int x) {
+    int a[2];
+    int y;
+    int i;
+    for (i = 0; i < 2; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[1] / 2;
+    p[0] = p[0] + x;
+    printf("f0 %d\n", p[0]);
+    return y;
+}
+
+float f1(int *p, int x) {
+    float a[3];
+    float y;
+    int i;
+    for (i = 0; i < 3; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[2] / 3;
+    p[0] = p[0] + x;
+    printf("f1 %d\n", p[0]);
+    return y;
+}
+
+double f2(int *p, int x) {
+    double a[4];
+    double y;
+    int i;
+    for (i = 0; i < 4; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[3] / 4;
+    p[0] = p[0] + x;
+    printf("f2 %d\n", p[0]);
+    return y;
+}
+
+int f3(int *p, int x) {
+    int a[5];
+    int y;
+    int i;
+    for (i = 0; i < 5; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[4] / 5;
+    p[0] = p[0] + x;
+    printf("f3 %d\n", p[0]);
+    return y;
+}
+
+float f4(int *p, int x) {
+    float a[6];
+    float y;
+    int i;
+    for (i = 0; i < 6; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[5] / 2;
+    p[0] = p[0] + x;
+    printf("f4 %d\n", p[0]);
+    return y;
+}
+
+double f5(int *p, int x) {
+    double a[7];
+    double y;
+    int i;
+    for (i = 0; i < 7; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[6] / 3;
+    p[0] = p[0] + x;
+    printf("f5 %d\n", p[0]);
+    return y;
+}
+
+int f6(int *p, int x) {
+    int a[8];
+    int y;
+    int i;
+    for (i = 0; i < 8; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[7] / 4;
+    p[0] = p[0] + x;
+    printf("f6 %d\n", p[0]);
+    return y;
+}
+
+float f7(int *p, int x) {
+    float a[2];
+    float y;
+    int i;
+    for (i = 0; i < 2; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[1] / 5;
+    p[0] = p[0] + x;
+    printf("f7 %d\n", p[0]);
+    return y;
+}
+
+double f8(int *p, int x) {
+    double a[3];
+    double y;
+    int i;
+    for (i = 0; i < 3; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[2] / 2;
+    p[0] = p[0] + x;
+    printf("f8 %d\n", p[0]);
+    return y;
+}
+
+int f9(int *p, int x) {
+    int a[4];
+    int y;
+    int i;
+    for (i = 0; i < 4; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[3] / 3;
+    p[0] = p[0] + x;
+    printf("f9 %d\n", p[0]);
+    return y;
+}
+
+float f10(int *p, int x) {
+    float a[5];
+    float y;
+    int i;
+    for (i = 0; i < 5; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[4] / 4;
+    p[0] = p[0] + x;
+    printf("f10 %d\n", p[0]);
+    return y;
+}
+
+double f11(int *p, int x) {
+    double a[6];
+    double y;
+    int i;
+    for (i = 0; i < 6; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[5] / 5;
+    p[0] = p[0] + x;
+    printf("f11 %d\n", p[0]);
+    return y;
+}
+
+int f12(int *p, int x) {
+    int a[7];
+    int y;
+    int i;
+    for (i = 0; i < 7; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[6] / 2;
+    p[0] = p[0] + x;
+    printf("f12 %d\n", p[0]);
+    return y;
+}
+
+float f13(int *p, int x) {
+    float a[8];
+    float y;
+    int i;
+    for (i = 0; i < 8; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[7] / 3;
+    p[0] = p[0] + x;
+    printf("f13 %d\n", p[0]);
+    return y;
+}
+
+double f14(int *p, int x) {
+    double a[2];
+    double y;
+    int i;
+    for (i = 0; i < 2; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[1] / 4;
+    p[0] = p[0] + x;
+    printf("f14 %d\n", p[0]);
+    return y;
+}
+
+int f15(int *p, int x) {
+    int a[3];
+    int y;
+    int i;
+    for (i = 0; i < 3; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[2] / 5;
+    p[0] = p[0] + x;
+    printf("f15 %d\n", p[0]);
+    return y;
+}
+
+float f16(int *p, int x) {
+    float a[4];
+    float y;
+    int i;
+    for (i = 0; i < 4; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[3] / 2;
+    p[0] = p[0] + x;
+    printf("f16 %d\n", p[0]);
+    return y;
+}
+
+double f17(int *p, int x) {
+    double a[5];
+    double y;
+    int i;
+    for (i = 0; i < 5; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[4] / 3;
+    p[0] = p[0] + x;
+    printf("f17 %d\n", p[0]);
+    return y;
+}
+
+int f18(int *p, int x) {
+    int a[6];
+    int y;
+    int i;
+    for (i = 0; i < 6; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[5] / 4;
+    p[0] = p[0] + x;
+    printf("f18 %d\n", p[0]);
+    return y;
+}
+
+float f19(int *p, int x) {
+    float a[7];
+    float y;
+    int i;
+    for (i = 0; i < 7; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[6] / 5;
+    p[0] = p[0] + x;
+    printf("f19 %d\n", p[0]);
+    return y;
+}
+
+double f20(int *p, int x) {
+    double a[8];
+    double y;
+    int i;
+    for (i = 0; i < 8; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[7] / 2;
+    p[0] = p[0] + x;
+    printf("f20 %d\n", p[0]);
+    return y;
+}
+
+int f21(int *p, int x) {
+    int a[2];
+    int y;
+    int i;
+    for (i = 0; i < 2; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[1] / 3;
+    p[0] = p[0] + x;
+    printf("f21 %d\n", p[0]);
+    return y;
+}
+
+float f22(int *p, int x) {
+    float a[3];
+    float y;
+    int i;
+    for (i = 0; i < 3; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[2] / 4;
+    p[0] = p[0] + x;
+    printf("f22 %d\n", p[0]);
+    return y;
+}
+
+double f23(int *p, int x) {
+    double a[4];
+    double y;
+    int i;
+    for (i = 0; i < 4; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[3] / 5;
+    p[0] = p[0] + x;
+    printf("f23 %d\n", p[0]);
+    return y;
+}
+
+int f24(int *p, int x) {
+    int a[5];
+    int y;
+    int i;
+    for (i = 0; i < 5; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[4] / 2;
+    p[0] = p[0] + x;
+    printf("f24 %d\n", p[0]);
+    return y;
+}
+
+float f25(int *p, int x) {
+    float a[6];
+    float y;
+    int i;
+    for (i = 0; i < 6; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[5] / 3;
+    p[0] = p[0] + x;
+    printf("f25 %d\n", p[0]);
+    return y;
+}
+
+double f26(int *p, int x) {
+    double a[7];
+    double y;
+    int i;
+    for (i = 0; i < 7; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[6] / 4;
+    p[0] = p[0] + x;
+    printf("f26 %d\n", p[0]);
+    return y;
+}
+
+int f27(int *p, int x) {
+    int a[8];
+    int y;
+    int i;
+    for (i = 0; i < 8; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[7] / 5;
+    p[0] = p[0] + x;
+    printf("f27 %d\n", p[0]);
+    return y;
+}
+
+float f28(int *p, int x) {
+    float a[2];
+    float y;
+    int i;
+    for (i = 0; i < 2; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[1] / 2;
+    p[0] = p[0] + x;
+    printf("f28 %d\n", p[0]);
+    return y;
+}
+
+double f29(int *p, int x) {
+    double a[3];
+    double y;
+    int i;
+    for (i = 0; i < 3; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[2] / 3;
+    p[0] = p[0] + x;
+    printf("f29 %d\n", p[0]);
+    return y;
+}
+
+int f30(int *p, int x) {
+    int a[4];
+    int y;
+    int i;
+    for (i = 0; i < 4; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[3] / 4;
+    p[0] = p[0] + x;
+    printf("f30 %d\n", p[0]);
+    return y;
+}
+
+float f31(int *p, int x) {
+    float a[5];
+    float y;
+    int i;
+    for (i = 0; i < 5; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[4] / 5;
+    p[0] = p[0] + x;
+    printf("f31 %d\n", p[0]);
+    return y;
+}
+
+double f32(int *p, int x) {
+    double a[6];
+    double y;
+    int i;
+    for (i = 0; i < 6; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[5] / 2;
+    p[0] = p[0] + x;
+    printf("f32 %d\n", p[0]);
+    return y;
+}
+
+int f33(int *p, int x) {
+    int a[7];
+    int y;
+    int i;
+    for (i = 0; i < 7; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[6] / 3;
+    p[0] = p[0] + x;
+    printf("f33 %d\n", p[0]);
+    return y;
+}
+
+float f34(int *p, int x) {
+    float a[8];
+    float y;
+    int i;
+    for (i = 0; i < 8; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[7] / 4;
+    p[0] = p[0] + x;
+    printf("f34 %d\n", p[0]);
+    return y;
+}
+
+double f35(int *p, int x) {
+    double a[2];
+    double y;
+    int i;
+    for (i = 0; i < 2; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[1] / 5;
+    p[0] = p[0] + x;
+    printf("f35 %d\n", p[0]);
+    return y;
+}
+
+int f36(int *p, int x) {
+    int a[3];
+    int y;
+    int i;
+    for (i = 0; i < 3; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[2] / 2;
+    p[0] = p[0] + x;
+    printf("f36 %d\n", p[0]);
+    return y;
+}
+
+float f37(int *p, int x) {
+    float a[4];
+    float y;
+    int i;
+    for (i = 0; i < 4; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[3] / 3;
+    p[0] = p[0] + x;
+    printf("f37 %d\n", p[0]);
+    return y;
+}
+
+double f38(int *p, int x) {
+    double a[5];
+    double y;
+    int i;
+    for (i = 0; i < 5; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[4] / 4;
+    p[0] = p[0] + x;
+    printf("f38 %d\n", p[0]);
+    return y;
+}
+
+int f39(int *p, int x) {
+    int a[6];
+    int y;
+    int i;
+    for (i = 0; i < 6; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[5] / 5;
+    p[0] = p[0] + x;
+    printf("f39 %d\n", p[0]);
+    return y;
+}
+
+float f40(int *p, int x) {
+    float a[7];
+    float y;
+    int i;
+    for (i = 0; i < 7; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[6] / 2;
+    p[0] = p[0] + x;
+    printf("f40 %d\n", p[0]);
+    return y;
+}
+
+double f41(int *p, int x) {
+    double a[8];
+    double y;
+    int i;
+    for (i = 0; i < 8; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[7] / 3;
+    p[0] = p[0] + x;
+    printf("f41 %d\n", p[0]);
+    return y;
+}
+
+int f42(int *p, int x) {
+    int a[2];
+    int y;
+    int i;
+    for (i = 0; i < 2; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[1] / 4;
+    p[0] = p[0] + x;
+    printf("f42 %d\n", p[0]);
+    return y;
+}
+
+float f43(int *p, int x) {
+    float a[3];
+    float y;
+    int i;
+    for (i = 0; i < 3; i++) {
+        a[i] = x + i * 4;
+    }
+    y = a[2] / 5;
+    p[0] = p[0] + x;
+    printf("f43 %d\n", p[0]);
+    return y;
+}
+
+double f44(int *p, int x) {
+    double a[4];
+    double y;
+    int i;
+    for (i = 0; i < 4; i++) {
+        a[i] = x + i * 5;
+    }
+    y = a[3] / 2;
+    p[0] = p[0] + x;
+    printf("f44 %d\n", p[0]);
+    return y;
+}
+
+int f45(int *p, int x) {
+    int a[5];
+    int y;
+    int i;
+    for (i = 0; i < 5; i++) {
+        a[i] = x + i * 1;
+    }
+    y = a[4] / 3;
+    p[0] = p[0] + x;
+    printf("f45 %d\n", p[0]);
+    return y;
+}
+
+float f46(int *p, int x) {
+    float a[6];
+    float y;
+    int i;
+    for (i = 0; i < 6; i++) {
+        a[i] = x + i * 2;
+    }
+    y = a[5] / 4;
+    p[0] = p[0] + x;
+    printf("f46 %d\n", p[0]);
+    return y;
+}
+
+double f47(int *p, int x) {
+    double a[7];
+    double y;
+    int i;
+    for (i = 0; i < 7; i++) {
+        a[i] = x + i * 3;
+    }
+    y = a[6] / 5;
+    p[0] = p[0] + x;
+    printf("f47 %d\n", p[0]);
+    return y;
+}
+
+int main(void) {
+    int s[1];
+    double total;
+    s[0] = 0;
+    total = 0;
+    total = total + f0(s, 0);
+    total = total + f1(s, 1);
+    total = total + f2(s, 2);
+    total = total + f3(s, 3);
+    total = total + f4(s, 4);
+    total = total + f5(s, 5);
+    total = total + f6(s, 6);
+    total = total + f7(s, 7);
+    total = total + f8(s, 8);
+    total = total + f9(s, 9);
+    total = total + f10(s, 10);
+    total = total + f11(s, 11);
+    total = total + f12(s, 12);
+    total = total + f13(s, 13);
+    total = total + f14(s, 14);
+    total = total + f15(s, 15);
+    total = total + f16(s, 16);
+    total = total + f17(s, 17);
+    total = total + f18(s, 18);
+    total = total + f19(s, 19);
+    total = total + f20(s, 20);
+    total = total + f21(s, 21);
+    total = total + f22(s, 22);
+    total = total + f23(s, 23);
+    total = total + f24(s, 24);
+    total = total + f25(s, 25);
+    total = total + f26(s, 26);
+    total = total + f27(s, 27);
+    total = total + f28(s, 28);
+    total = total + f29(s, 29);
+    total = total + f30(s, 30);
+    total = total + f31(s, 31);
+    total = total + f32(s, 32);
+    total = total + f33(s, 33);
+    total = total + f34(s, 34);
+    total = total + f35(s, 35);
+    total = total + f36(s, 36);
+    total = total + f37(s, 37);
+    total = total + f38(s, 38);
+    total = total + f39(s, 39);
+    total = total + f40(s, 40);
+    total = total + f41(s, 41);
+    total = total + f42(s, 42);
+    total = total + f43(s, 43);
+    total = total + f44(s, 44);
+    total = total + f45(s, 45);
+    total = total + f46(s, 46);
+    total = total + f47(s, 47);
+    printf("%d %f\n", s[0], total);
+    return 0;
+}
@@ -0,0 +1,35 @@
+int triangle(int n) {
+    int i;
+    int j;
+    int s;
+    s = 0;
+    for (i = 0; i < n; i++) {
+        for (j = 0; j <= i; j++) {
+            s = s + j;
+        }
+    }
+    return s;
+}
+int main(void) {
+    int a;
+    int b;
+    int t;
+    int k;
+    int last;
+    a = 1;
+    b = 2;
+    last = 0;
+    k = 0;
+    while (k < 5) {
+        t = a;
+        a = b;
+        b = t;
+        if (k > 2) {
+            last = k;
+        }
+        k = k + 1;
+    }
+    printf("%d %d %d %d\n", a, b, last, k);
+    printf("%d %d\n", triangle(4), triangle(0));
+    return 0;
+}
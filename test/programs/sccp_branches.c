@@ -0,0 +1,34 @@
+int divide(int n, int d) {
+    int q;
+    q = 0;
+    if (n > 100) {
+        q = 7 / 0;
+    }
+    if (n > 200) {
+        q = (0 - 2147483647 - 1) / (0 - 1);
+    }
+    return q + n / d;
+}
+int main(void) {
+    int x;
+    int i;
+    int y;
+    x = 3;
+    y = 0;
+    if (x > 5) {
+        y = 100;
+    }
+    if (x < 5) {
+        y = y + 1;
+    }
+    i = 0;
+    while (i < 10) {
+        if (x > 5) {
+            x = 2;
+        }
+        i++;
+    }
+    printf("%d %d %d\n", x, y, i);
+    printf("%d %d\n", divide(8, 0 - 1), divide(9, 3));
+    return 0;
+}
@@ -0,0 +1,33 @@
+int touch(int v) {
+    printf("touch %d\n", v);
+    return v;
+}
+int main(void) {
+    int x;
+    int y;
+    int n;
+    float half;
+    x = touch(0) && touch(1);
+    y = touch(1) || touch(2);
+    printf("%d %d\n", x, y);
+    x = touch(2) && touch(0);
+    y = touch(0) || (touch(0) || touch(3));
+    printf("%d %d\n", x, y);
+    n = 0;
+    while (n < 10 && touch(n) < 3) {
+        n++;
+    }
+    if (n > 100 || touch(5) > 4 && touch(6) < 6) {
+        n = n + 1000;
+    }
+    printf("%d\n", n);
+    half = 1;
+    half = half / 2;
+    x = half && touch(7);
+    y = half || touch(8);
+    half = 0;
+    x = x * 10 + (half && touch(9));
+    y = y * 10 + (half || touch(0));
+    printf("%d %d\n", x, y);
+    return 0;
+}
@@ -0,0 +1,58 @@
+int classify(int v) {
+    int r;
+    r = 0;
+    switch (v) {
+    case 1:
+        r = 10;
+        break;
+    case 2:
+    case 1 + 2:
+        r = 20;
+    case 4:
+        r = r + 5;
+        break;
+    default:
+        r = 99;
+    }
+    return r;
+}
+int sparse(int v) {
+    int r;
+    r = 7;
+    switch (v) {
+    case 5:
+        r = 1;
+        break;
+    case 7 * 1000:
+        r = 3;
+        break;
+    case 123456:
+        r = 4;
+    }
+    return r;
+}
+int main(void) {
+    int i;
+    int total;
+    int hits;
+    printf("%d %d %d %d %d\n", classify(1), classify(2), classify(3), classify(4), classify(9));
+    printf("%d %d %d %d\n", sparse(5), sparse(7000), sparse(123456), sparse(6));
+    total = 0;
+    hits = 0;
+    for (i = 0; i < 6; i++) {
+        switch (i) {
+        case 0:
+            total = total + 1;
+        case 1:
+            total = total + 10;
+            break;
+        case 4:
+            break;
+        default:
+            hits++;
+        }
+        total = total + 100;
+    }
+    printf("%d %d %d\n", total, hits, i);
+    return 0;
+}